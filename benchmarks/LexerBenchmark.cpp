@@ -0,0 +1,146 @@
+/**
+ * @file LexerBenchmark.cpp
+ * @brief Compares the LexerDFA table-driven scanner with the hand-written one.
+ *
+ * The input files are concatenated and repeated until the corpus reaches the
+ * requested size, then each scanning mode tokenizes it several times from
+ * memory. The best run of each mode is reported, followed by the table-driven
+ * scanner at every CharScan SIMD level the CPU supports and the ParallelLexer
+ * at a few thread counts.
+ *
+ * Usage:
+ * - ./lexbench [-m <megabytes>] [-r <runs>] <input_file> [input_file ...]
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#include "Scanner/Scanner.h"
+#include "Scanner/CharScan.h"
+#include "Scanner/ParallelLexer.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct RunResult {
+    double seconds;
+    size_t tokenCount;
+};
+
+RunResult scanOnce(const std::string& corpus, bool useTransitionTable) {
+    Scanner scanner(corpus.data(), corpus.size());
+    scanner.setUseTransitionTable(useTransitionTable);
+
+    auto start = std::chrono::steady_clock::now();
+    size_t tokenCount = 0;
+    while (scanner.getNextToken().kind != TokenType::END_OF_FILE) {
+        tokenCount++;
+    }
+    auto stop = std::chrono::steady_clock::now();
+    return {std::chrono::duration<double>(stop - start).count(), tokenCount};
+}
+
+RunResult lexInParallel(const std::string& corpus, size_t threads) {
+    auto source = std::make_shared<const SourceBuffer>(corpus.data(), corpus.size());
+
+    auto start = std::chrono::steady_clock::now();
+    ParallelLexer lexer(source, threads);
+    size_t tokenCount = lexer.run().size();
+    auto stop = std::chrono::steady_clock::now();
+    return {std::chrono::duration<double>(stop - start).count(), tokenCount};
+}
+
+RunResult bestOf(const std::string& corpus, bool useTransitionTable, int runs) {
+    RunResult best = scanOnce(corpus, useTransitionTable);
+    for (int i = 1; i < runs; ++i) {
+        RunResult result = scanOnce(corpus, useTransitionTable);
+        if (result.seconds < best.seconds) best = result;
+    }
+    return best;
+}
+
+void report(const std::string& name, const RunResult& result, size_t bytes) {
+    double megabytes = bytes / (1024.0 * 1024.0);
+    std::cout << name << ": " << result.tokenCount << " tokens in "
+              << result.seconds * 1000.0 << " ms ("
+              << megabytes / result.seconds << " MB/s, "
+              << result.tokenCount / result.seconds / 1e6 << " Mtokens/s)" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t targetMegabytes = 16;
+    int runs = 5;
+    std::vector<std::string> inputFiles;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "-m" && i + 1 < argc) {
+            targetMegabytes = std::stoul(argv[++i]);
+        } else if (arg == "-r" && i + 1 < argc) {
+            runs = std::stoi(argv[++i]);
+        } else {
+            inputFiles.push_back(arg);
+        }
+    }
+
+    if (inputFiles.empty()) {
+        std::cout << "Usage: " << argv[0] << " [-m <megabytes>] [-r <runs>] <input_file> [input_file ...]" << std::endl;
+        return 1;
+    }
+
+    std::string sources;
+    for (const auto& file : inputFiles) {
+        std::ifstream input(file, std::ios::binary);
+        if (!input.is_open()) {
+            std::cerr << "Error: Unable to open file " << file << std::endl;
+            return 1;
+        }
+        std::ostringstream contents;
+        contents << input.rdbuf() << "\n";
+        sources += contents.str();
+    }
+
+    std::string corpus;
+    corpus.reserve(targetMegabytes * 1024 * 1024 + sources.size());
+    while (corpus.size() < targetMegabytes * 1024 * 1024) {
+        corpus += sources;
+    }
+
+    std::cout << "Corpus: " << corpus.size() << " bytes, best of " << runs << " runs" << std::endl;
+    RunResult branches = bestOf(corpus, false, runs);
+    RunResult table = bestOf(corpus, true, runs);
+    report("hand-written branches", branches, corpus.size());
+    report("LexerDFA table       ", table, corpus.size());
+    std::cout << "speedup: " << branches.seconds / table.seconds << "x" << std::endl;
+
+    CharScan::SimdLevel best = CharScan::detectedLevel();
+    for (int level = 0; level <= static_cast<int>(best); ++level) {
+        CharScan::setLevel(static_cast<CharScan::SimdLevel>(level));
+        std::string name = std::string("LexerDFA table, ") + CharScan::levelName(CharScan::activeLevel());
+        name.resize(21, ' ');
+        report(name, bestOf(corpus, true, runs), corpus.size());
+    }
+    CharScan::setLevel(best);
+
+    size_t hardwareThreads = std::max(2u, std::thread::hardware_concurrency());
+    for (size_t threads = 2; threads <= hardwareThreads; threads *= 2) {
+        RunResult parallel = lexInParallel(corpus, threads);
+        for (int i = 1; i < runs; ++i) {
+            RunResult result = lexInParallel(corpus, threads);
+            if (result.seconds < parallel.seconds) parallel = result;
+        }
+        std::string name = "ParallelLexer, " + std::to_string(threads) + " thr";
+        name.resize(21, ' ');
+        report(name, parallel, corpus.size());
+    }
+    return 0;
+}
@@ -0,0 +1,126 @@
+/**
+ * @file ParserBenchmark.cpp
+ * @brief Compares the table-driven parser with the generated recursive-descent parser.
+ *
+ * Each input file is read into memory once, then every backend parses all of
+ * them a number of times per run, building the AST as the compiler does. The
+ * best run of each backend is reported. The inputs should be valid programs:
+ * the recursive-descent parser stops at the first syntax error, so erroneous
+ * files would not be comparable.
+ *
+ * Usage:
+ * - ./parsebench [-n <iterations>] [-r <runs>] <input_file> [input_file ...]
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#include "Parser/Parser.h"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Source {
+    std::string name;
+    std::string contents;
+};
+
+struct RunResult {
+    double seconds;
+    size_t accepted;
+};
+
+RunResult parseAll(const std::vector<Source>& sources, std::shared_ptr<const ParsingTable> table,
+                   bool recursiveDescent, int iterations) {
+    const Source& front = sources.front();
+    Parser parser(front.name, table, Scanner(front.contents.data(), front.contents.size()));
+    parser.setRecursiveDescent(recursiveDescent);
+
+    auto start = std::chrono::steady_clock::now();
+    size_t accepted = 0;
+    bool first = true;
+    for (int i = 0; i < iterations; ++i) {
+        for (const Source& source : sources) {
+            if (!first) {
+                parser.reset(source.name, Scanner(source.contents.data(), source.contents.size()));
+            }
+            first = false;
+            if (parser.parse()) accepted++;
+        }
+    }
+    auto stop = std::chrono::steady_clock::now();
+    return {std::chrono::duration<double>(stop - start).count(), accepted};
+}
+
+RunResult bestOf(const std::vector<Source>& sources, std::shared_ptr<const ParsingTable> table,
+                 bool recursiveDescent, int iterations, int runs) {
+    RunResult best = parseAll(sources, table, recursiveDescent, iterations);
+    for (int i = 1; i < runs; ++i) {
+        RunResult result = parseAll(sources, table, recursiveDescent, iterations);
+        if (result.seconds < best.seconds) best = result;
+    }
+    return best;
+}
+
+void report(const std::string& name, const RunResult& result, size_t parses, size_t bytes) {
+    double megabytes = bytes / (1024.0 * 1024.0);
+    std::cout << name << ": " << result.accepted << "/" << parses << " accepted in "
+              << result.seconds * 1000.0 << " ms ("
+              << megabytes / result.seconds << " MB/s, "
+              << result.seconds * 1e6 / parses << " us/file)" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int iterations = 200;
+    int runs = 5;
+    std::vector<std::string> inputFiles;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "-n" && i + 1 < argc) {
+            iterations = std::stoi(argv[++i]);
+        } else if (arg == "-r" && i + 1 < argc) {
+            runs = std::stoi(argv[++i]);
+        } else {
+            inputFiles.push_back(arg);
+        }
+    }
+
+    if (inputFiles.empty()) {
+        std::cout << "Usage: " << argv[0] << " [-n <iterations>] [-r <runs>] <input_file> [input_file ...]" << std::endl;
+        return 1;
+    }
+
+    std::vector<Source> sources;
+    size_t bytes = 0;
+    for (const auto& file : inputFiles) {
+        std::ifstream input(file, std::ios::binary);
+        if (!input.is_open()) {
+            std::cerr << "Error: Unable to open file " << file << std::endl;
+            return 1;
+        }
+        std::ostringstream contents;
+        contents << input.rdbuf();
+        sources.push_back({file, contents.str()});
+        bytes += sources.back().contents.size();
+    }
+
+    std::shared_ptr<const ParsingTable> table = Parser::loadTable("");
+    const size_t parses = sources.size() * iterations;
+    std::cout << "Corpus: " << sources.size() << " files, " << bytes << " bytes, "
+              << iterations << " iterations, best of " << runs << " runs" << std::endl;
+    RunResult tableDriven = bestOf(sources, table, false, iterations, runs);
+    RunResult recursiveDescent = bestOf(sources, table, true, iterations, runs);
+    report("table-driven     ", tableDriven, parses, bytes * iterations);
+    report("recursive descent", recursiveDescent, parses, bytes * iterations);
+    std::cout << "speedup: " << tableDriven.seconds / recursiveDescent.seconds << "x" << std::endl;
+    return 0;
+}
@@ -0,0 +1,311 @@
+/**
+ * @file TableBenchmark.cpp
+ * @brief Compares layouts of the parsing table on the lookups of real parses.
+ *
+ * The input files are parsed with the built-in table, recording every
+ * (non-terminal, terminal) lookup the parser makes. The trace is then replayed
+ * against three layouts of the same table:
+ * - dense: one production ID per cell, [non-terminal][terminal];
+ * - hashed: std::unordered_map from (non-terminal, terminal) to production,
+ *   holding the non-empty cells only;
+ * - row displacement: the layout ParsingTable uses.
+ *
+ * For each layout the benchmark reports its size, the cache lines the trace
+ * touches, the hit rate of a simulated L1 data cache and the time per lookup.
+ * The simulated cache is 8-way set associative with 64-byte lines and LRU
+ * replacement, and sees the addresses each lookup reads, starting cold. It is
+ * run at several sizes: besides the full 32 KiB, the smaller ones stand for
+ * the share of L1 left to the table while the parse stack, the tokens and the
+ * AST compete for it. Hashed lookups read a bucket slot, then the nodes of the
+ * bucket up to the one found.
+ *
+ * Usage:
+ * - ./tablebench [-r <runs>] <input_file> [input_file ...]
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#include "Parser/ParsingTable.h"
+#include "Parser/AttributeGrammarTable.h"
+#include "Scanner/Scanner.h"
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+using Symbol = ParsingTable::Symbol;
+using ProductionId = ParsingTable::ProductionId;
+
+/// One table lookup: a non-terminal row and a terminal column.
+struct Lookup {
+    uint16_t row;
+    Symbol terminal;
+};
+
+/**
+ * @brief Set-associative cache with LRU replacement, counting hits and misses.
+ */
+class CacheSimulator {
+public:
+    static constexpr size_t LINE_SIZE = 64;
+    static constexpr size_t WAYS = 8;
+
+    explicit CacheSimulator(size_t bytes) : sets(bytes / LINE_SIZE / WAYS), lines(sets * WAYS, EMPTY) {}
+
+    void access(const void* address) {
+        const uintptr_t line = reinterpret_cast<uintptr_t>(address) / LINE_SIZE;
+        // Ways of a set are kept most recently used first.
+        uintptr_t* set = &lines[(line % sets) * WAYS];
+        size_t way = 0;
+        while (way < WAYS - 1 && set[way] != line) {
+            ++way;
+        }
+        if (set[way] == line) {
+            hits++;
+        } else {
+            misses++;
+        }
+        for (; way > 0; --way) {
+            set[way] = set[way - 1];
+        }
+        set[0] = line;
+    }
+
+    double hitRate() const { return hits + misses == 0 ? 0.0 : static_cast<double>(hits) / (hits + misses); }
+
+private:
+    static constexpr uintptr_t EMPTY = UINTPTR_MAX;
+    size_t sets;
+    std::vector<uintptr_t> lines;
+    size_t hits = 0;
+    size_t misses = 0;
+};
+
+/**
+ * @brief One production ID per cell.
+ */
+class DenseLayout {
+public:
+    explicit DenseLayout(const ParsingTable& table)
+        : terminalCount(table.getTerminals().size()),
+          cells(table.getNonTerminals().size() * terminalCount, ParsingTable::NO_PRODUCTION) {
+        for (size_t row = 0; row < table.getNonTerminals().size(); ++row) {
+            for (size_t t = 0; t < terminalCount; ++t) {
+                cells[row * terminalCount + t] = table.getProduction(static_cast<Symbol>(terminalCount + row),
+                                                                     static_cast<Symbol>(t));
+            }
+        }
+    }
+
+    ProductionId lookup(Lookup at) const { return cells[at.row * terminalCount + at.terminal]; }
+
+    template <typename Visit>
+    void visit(Lookup at, Visit&& touch) const { touch(&cells[at.row * terminalCount + at.terminal]); }
+
+    size_t bytes() const { return cells.size() * sizeof(ProductionId); }
+
+private:
+    size_t terminalCount;
+    std::vector<ProductionId> cells;
+};
+
+/**
+ * @brief Non-empty cells in a hash map keyed by row and terminal.
+ */
+class HashedLayout {
+public:
+    explicit HashedLayout(const ParsingTable& table) {
+        const size_t terminalCount = table.getTerminals().size();
+        for (size_t row = 0; row < table.getNonTerminals().size(); ++row) {
+            for (size_t t = 0; t < terminalCount; ++t) {
+                ProductionId production = table.getProduction(static_cast<Symbol>(terminalCount + row),
+                                                              static_cast<Symbol>(t));
+                if (production != ParsingTable::NO_PRODUCTION) {
+                    cells.emplace(key({static_cast<uint16_t>(row), static_cast<Symbol>(t)}), production);
+                }
+            }
+        }
+        // The bucket array is not reachable; a vector of the same size stands in for it.
+        buckets.resize(cells.bucket_count());
+    }
+
+    ProductionId lookup(Lookup at) const {
+        auto it = cells.find(key(at));
+        return it != cells.end() ? it->second : ParsingTable::NO_PRODUCTION;
+    }
+
+    template <typename Visit>
+    void visit(Lookup at, Visit&& touch) const {
+        const size_t bucket = cells.bucket(key(at));
+        touch(&buckets[bucket]);
+        for (auto it = cells.begin(bucket); it != cells.end(bucket); ++it) {
+            touch(&*it);
+            if (it->first == key(at)) break;
+        }
+    }
+
+    size_t bytes() const {
+        // Each node holds the next pointer and the key/value pair.
+        return buckets.size() * sizeof(void*) + cells.size() * (sizeof(void*) + sizeof(std::pair<const uint32_t, ProductionId>));
+    }
+
+private:
+    static uint32_t key(Lookup at) { return static_cast<uint32_t>(at.row) << 16 | at.terminal; }
+
+    std::unordered_map<uint32_t, ProductionId> cells;
+    std::vector<void*> buckets;
+};
+
+/**
+ * @brief The row-displacement layout of ParsingTable itself.
+ */
+class DisplacedLayout {
+public:
+    explicit DisplacedLayout(const ParsingTable& table)
+        : table(table), terminalCount(static_cast<Symbol>(table.getTerminals().size())) {}
+
+    ProductionId lookup(Lookup at) const {
+        return table.getProduction(static_cast<Symbol>(terminalCount + at.row), at.terminal);
+    }
+
+    template <typename Visit>
+    void visit(Lookup at, Visit&& touch) const {
+        const uint32_t& offset = table.getRowOffsets()[at.row];
+        touch(&offset);
+        touch(&table.getPackedCells()[offset + at.terminal]);
+    }
+
+    size_t bytes() const {
+        return table.getRowOffsets().size() * sizeof(uint32_t) +
+               table.getPackedCells().size() * sizeof(ParsingTable::PackedCell);
+    }
+
+private:
+    const ParsingTable& table;
+    Symbol terminalCount;
+};
+
+/**
+ * @brief Parses a file with the table, without semantic actions, recording every lookup.
+ * @return False if the file has a syntax error; the lookups up to the error are kept.
+ */
+bool traceParse(const ParsingTable& table, const std::string& file, std::vector<Lookup>& trace) {
+    Scanner scanner(file);
+    auto next = [&scanner]() {
+        Token token = scanner.getNextToken();
+        while (isCommentType(token.kind) || isErrorType(token.kind)) {
+            token = scanner.getNextToken();
+        }
+        return token;
+    };
+
+    const Symbol terminalCount = static_cast<Symbol>(table.getTerminals().size());
+    std::vector<Symbol> stack{table.getEndSymbol(), table.getStartSymbol()};
+    Token lookahead = next();
+    while (stack.back() != table.getEndSymbol()) {
+        const Symbol top = stack.back();
+        const Symbol terminal = table.getTerminal(lookahead.kind);
+        if (table.isTerminal(top)) {
+            if (top != terminal) return false;
+            stack.pop_back();
+            lookahead = next();
+        } else if (table.isNonTerminal(top)) {
+            if (terminal == ParsingTable::NO_SYMBOL) return false;
+            trace.push_back({static_cast<uint16_t>(top - terminalCount), terminal});
+            ProductionId production = table.getProduction(top, terminal);
+            if (production == ParsingTable::NO_PRODUCTION) return false;
+            stack.pop_back();
+            ParsingTable::ReversedRHS rhs = table.getReversedRHS(production);
+            stack.insert(stack.end(), rhs.begin(), rhs.end());
+        } else {
+            stack.pop_back();
+        }
+    }
+    return lookahead.kind == TokenType::END_OF_FILE;
+}
+
+template <typename Layout>
+void report(const std::string& name, const Layout& layout, const std::vector<Lookup>& trace, int runs) {
+    std::unordered_set<uintptr_t> lines;
+    for (const Lookup& at : trace) {
+        layout.visit(at, [&lines](const void* address) {
+            lines.insert(reinterpret_cast<uintptr_t>(address) / CacheSimulator::LINE_SIZE);
+        });
+    }
+    std::cout << name << ": " << std::setw(6) << layout.bytes() << " bytes, "
+              << std::setw(4) << lines.size() << " lines touched, L1 hit rate";
+
+    for (size_t kilobytes : {32, 4, 1}) {
+        CacheSimulator cache(kilobytes * 1024);
+        for (const Lookup& at : trace) {
+            layout.visit(at, [&cache](const void* address) { cache.access(address); });
+        }
+        std::cout << " " << kilobytes << "K " << std::fixed << std::setprecision(2) << cache.hitRate() * 100.0 << "%";
+    }
+
+    double best = 0.0;
+    size_t checksum = 0;
+    for (int run = 0; run < runs; ++run) {
+        auto start = std::chrono::steady_clock::now();
+        for (const Lookup& at : trace) {
+            checksum += layout.lookup(at);
+        }
+        auto stop = std::chrono::steady_clock::now();
+        double seconds = std::chrono::duration<double>(stop - start).count();
+        if (run == 0 || seconds < best) best = seconds;
+    }
+    std::cout << ", " << std::setprecision(2) << best * 1e9 / trace.size() << " ns/lookup"
+              << " (checksum " << checksum % 1000 << ")" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int runs = 20;
+    std::vector<std::string> inputFiles;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "-r" && i + 1 < argc) {
+            runs = std::stoi(argv[++i]);
+        } else {
+            inputFiles.push_back(arg);
+        }
+    }
+
+    if (inputFiles.empty()) {
+        std::cout << "Usage: " << argv[0] << " [-r <runs>] <input_file> [input_file ...]" << std::endl;
+        return 1;
+    }
+
+    ParsingTable table(AttributeGrammarTable::table);
+    std::vector<Lookup> trace;
+    size_t rejected = 0;
+    for (const auto& file : inputFiles) {
+        if (!traceParse(table, file, trace)) rejected++;
+    }
+    if (trace.empty()) {
+        std::cerr << "Error: No table lookups in the input files" << std::endl;
+        return 1;
+    }
+
+    size_t filled = 0;
+    for (const ParsingTable::PackedCell& cell : table.getPackedCells()) {
+        filled += cell.row != ParsingTable::NO_SYMBOL;
+    }
+    std::cout << "Table: " << table.getNonTerminals().size() << " x " << table.getTerminals().size() << " cells, "
+              << filled << " filled" << std::endl;
+    std::cout << "Trace: " << trace.size() << " lookups from " << inputFiles.size() << " files ("
+              << rejected << " stopped at a syntax error), best of " << runs << " runs" << std::endl;
+    report("dense           ", DenseLayout(table), trace, runs);
+    report("hashed          ", HashedLayout(table), trace, runs);
+    report("row displacement", DisplacedLayout(table), trace, runs);
+    return 0;
+}
@@ -6,7 +6,7 @@
 void printUsage(const std::string& programName) {
     std::cout << "Usage: " << programName << " [--table parsing_table.csv] file1 [file2 ...]\n"
               << "Options:\n"
-              << "  --table <csv_file>   Specify a custom parsing table CSV file. Default is 'parsing_table.csv'.\n"
+              << "  --table <csv_file>   Specify a custom parsing table CSV file. Default is the built-in attribute grammar table.\n"
               << "  -h, --help           Show this help message.\n";
 }
 
@@ -16,7 +16,7 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    std::string tableFile = "attribute_grammar_parsing_table.csv";
+    std::string tableFile; // Empty: the attribute grammar table compiled into the program
     std::vector<std::string> inputFiles;
 
     for (int i = 1; i < argc; ) {
@@ -44,9 +44,12 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
+    // Load the table once; every parser below shares it.
+    std::shared_ptr<const ParsingTable> table = Parser::loadTable(tableFile);
+
     for (const auto& file : inputFiles) {
-        std::cout << "Parsing file: " << file << " with table: " << tableFile << std::endl;
-        Parser parser(file, tableFile);
+        std::cout << "Parsing file: " << file << " with table: " << (tableFile.empty() ? "built-in" : tableFile) << std::endl;
+        Parser parser(file, table, Scanner(file));
         parser.parse();
     }
 
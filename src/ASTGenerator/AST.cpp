@@ -1,4 +1,6 @@
 #include "AST.h"
+#include <stdexcept>
+#include <utility>
 
 void DD(std::string s){
     std::cout << s << std::endl;
@@ -35,21 +37,61 @@ std::string escapeForDot(const std::string& str) {
     return result;
 }
 
-AST::AST() : root(nullptr) {
+AST::AST() : root(nullptr), ownArena(std::make_unique<ASTArena>()), arena(ownArena.get()) {
     // Initialize empty AST
 }
 
+AST::~AST() {
+    // The nodes are freed with the arena that owns them
+    ASTStack.clear();
+}
 
+AST::AST(AST&& other) noexcept
+    : root(other.root), ASTStack(std::move(other.ASTStack)), ownArena(std::move(other.ownArena)), arena(other.arena) {
+    other.root = nullptr;
+    other.ASTStack.clear();
+    if (arena == ownArena.get()) {
+        other.arena = nullptr;
+    }
+}
 
-AST::~AST() {
-    // Clean up the tree by deleting the root node (which will recursively delete children)
+AST& AST::operator=(AST&& other) noexcept {
+    if (this != &other) {
+        root = other.root;
+        ASTStack = std::move(other.ASTStack);
+        ownArena = std::move(other.ownArena);
+        arena = other.arena;
+        other.root = nullptr;
+        other.ASTStack.clear();
+        if (arena == ownArena.get()) {
+            other.arena = nullptr;
+        }
+    }
+    return *this;
+}
+
+ASTArena& AST::getArena() {
+    // The own arena went with the nodes when this AST was moved from
+    if (arena == nullptr) {
+        ownArena = std::make_unique<ASTArena>();
+        arena = ownArena.get();
+    }
+    return *arena;
+}
+
+void AST::clear() {
+    root = nullptr;
     ASTStack.clear();
+    if (ownArena) {
+        ownArena->release();
+    }
 }
 
 // Update createNode method to set line number
-ASTNode* AST::createNode(NodeType nodeType, std::string nodeValue, int line) {
-    ASTNode* node = new ASTNode(nodeType, nodeValue);
+ASTNode* AST::createNode(NodeType nodeType, std::string_view nodeValue, int line, SymbolId symbol) {
+    ASTNode* node = getArena().create(nodeType, std::string(nodeValue));
     node->setLineNumber(line);
+    node->setSymbolId(symbol);
     return node;
 }
 
@@ -107,6 +149,22 @@ void AST::writeToFile(std::string filename) {
     outFile.close();
 }
 
+ASTNode* AST::popNode() {
+    ASTNode* node = topNode();
+    if (node == root) {
+        throw std::runtime_error("Semantic stack underflow: the root node cannot be popped");
+    }
+    ASTStack.pop_back();
+    return node;
+}
+
+ASTNode* AST::topNode(size_t depth) const {
+    if (depth >= ASTStack.size()) {
+        throw std::runtime_error("Semantic stack underflow");
+    }
+    return ASTStack[ASTStack.size() - 1 - depth];
+}
+
 ASTNode* AST::makeFamily(NodeType op, ASTNode* kid1, ASTNode* kid2) {
     ASTNode* parent = createNode(op, "", kid1->getLineNumber());
     parent->adoptChildren(kid1->makeSiblings(kid2));
@@ -129,20 +187,24 @@ ASTNode* AST::getRoot() {
     return root;
 }
 
-void AST::performAction(std::string action, std::string value, int line) {
+SemanticAction AST::resolveAction(std::string_view name) {
+    return resolveSemanticAction(name);
+}
 
+void AST::performAction(SemanticAction action, std::string_view value, int line, SymbolId symbol, LiteralValue literal) {
+    switch (action) {
     // Program Structure Actions
-    if (action == "_createRoot") {
+    case SemanticAction::CREATE_ROOT: {
         this->root = makeFamily(NodeType::PROGRAM,
             createNode(NodeType::CLASS_LIST, "classList", line),
             createNode(NodeType::IMPLEMENTATION_LIST, "implList", line),
             createNode(NodeType::FUNCTION_LIST, "functionList", line)
         );
         this->ASTStack.push_back(this->root);
+        break;
     }
-    else if (action == "_addToProgram") {
-        ASTNode* node = ASTStack.back();
-        ASTStack.pop_back();
+    case SemanticAction::ADD_TO_PROGRAM: {
+        ASTNode* node = popNode();
         
         switch (node->getNodeEnum()) {
             case NodeType::CLASS:
@@ -158,319 +220,376 @@ void AST::performAction(std::string action, std::string value, int line) {
                 break;
         }
         this->root = ASTStack.front();
+        break;
     }
 
     // Class-Related Actions
-    else if (action == "_createClassId") {
-        ASTStack.push_back(createNode(NodeType::CLASS_ID, value, line));
+    case SemanticAction::CREATE_CLASS_ID: {
+        ASTStack.push_back(createNode(NodeType::CLASS_ID, value, line, symbol));
+        break;
     }
-    else if (action == "_createInheritanceList") {
+    case SemanticAction::CREATE_INHERITANCE_LIST: {
         ASTStack.push_back(createNode(NodeType::INHERITANCE_LIST, "inheritanceList", line));
+        break;
     }
-    else if (action == "_addInheritanceId") {
-        ASTNode* inheritId = createNode(NodeType::INHERITANCE_ID, value, line);
+    case SemanticAction::ADD_INHERITANCE_ID: {
+        ASTNode* inheritId = createNode(NodeType::INHERITANCE_ID, value, line, symbol);
         if (!ASTStack.empty()) {
-            ASTStack.back()->adoptChildren(inheritId);
+            topNode()->adoptChildren(inheritId);
         }
+        break;
     }
-    else if (action == "_createClass") {
-        ASTNode* memberList = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* inheritList = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* classId = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::CREATE_CLASS: {
+        ASTNode* memberList = popNode();
+        ASTNode* inheritList = popNode();
+        ASTNode* classId = popNode();
         
         ASTNode* classNode = makeFamily(NodeType::CLASS, classId, inheritList, memberList);
         ASTStack.push_back(classNode);
+        break;
     }
-    else if (action == "_addMemberList") {
+    case SemanticAction::ADD_MEMBER_LIST: {
         ASTStack.push_back(createNode(NodeType::MEMBER_LIST, "memberList", line));
+        break;
     }
 
     // Implementation-Related Actions
-    else if (action == "_createImplementationId") {
-        ASTStack.push_back(createNode(NodeType::IMPLEMENTATION_ID, value, line));
-    }
-    else if (action == "_addImplementationFunction") {
-        ASTNode* function = ASTStack.back();ASTStack.pop_back();
-        ASTStack.back()->adoptChildren(function);
-    }
-    else if (action == "_createImplementation") {
-        ASTNode* functions = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* implId = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::CREATE_IMPLEMENTATION_ID: {
+        ASTStack.push_back(createNode(NodeType::IMPLEMENTATION_ID, value, line, symbol));
+        break;
+    }
+    case SemanticAction::ADD_IMPLEMENTATION_FUNCTION: {
+        ASTNode* function = popNode();
+        topNode()->adoptChildren(function);
+        break;
+    }
+    case SemanticAction::CREATE_IMPLEMENTATION: {
+        ASTNode* functions = popNode();
+        ASTNode* implId = popNode();
         
         ASTNode* impl = makeFamily(NodeType::IMPLEMENTATION, implId, functions);
         ASTStack.push_back(impl);
+        break;
     }
 
     // Function-Related Actions
-   else if (action == "_createFunctionId") {
-        ASTStack.push_back(createNode(NodeType::FUNCTION_ID, value, line));
-    }
-    else if (action == "_setConstructor") {
-        ASTStack.back()->setNodeValue("constructor");
-    }
-    else if (action == "_createFunctionSignature") {
-        ASTNode* returnType = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* params = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* funcId = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::CREATE_FUNCTION_ID: {
+        ASTStack.push_back(createNode(NodeType::FUNCTION_ID, value, line, symbol));
+        break;
+    }
+    case SemanticAction::SET_CONSTRUCTOR: {
+        topNode()->setNodeValue("constructor");
+        break;
+    }
+    case SemanticAction::CREATE_FUNCTION_SIGNATURE: {
+        ASTNode* returnType = popNode();
+        ASTNode* params = popNode();
+        ASTNode* funcId = popNode();
         
         ASTNode* signature = makeFamily(NodeType::FUNCTION_SIGNATURE, funcId, params, returnType);
         ASTStack.push_back(signature);
+        break;
     }
-    else if (action == "_createConstructorSignature") {
-        ASTNode* params = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* funcId = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::CREATE_CONSTRUCTOR_SIGNATURE: {
+        ASTNode* params = popNode();
+        ASTNode* funcId = popNode();
         
         ASTNode* signature = makeFamily(NodeType::CONSTRUCTOR_SIGNATURE, funcId, params);
         ASTStack.push_back(signature);
+        break;
     }
-    else if (action == "_createFunctionBody") {
-        ASTStack.back()->setNodeType(NodeType::FUNCTION_BODY);
-        ASTStack.back()->setNodeValue("");
+    case SemanticAction::CREATE_FUNCTION_BODY: {
+        topNode()->setNodeType(NodeType::FUNCTION_BODY);
+        topNode()->setNodeValue("");
+        break;
     }
-    else if (action == "_createFunction") {
-        ASTNode* body = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* signature = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::CREATE_FUNCTION: {
+        ASTNode* body = popNode();
+        ASTNode* signature = popNode();
         
         ASTNode* function = makeFamily(NodeType::FUNCTION, signature, body);
         ASTStack.push_back(function);
+        break;
     }
 
     // Member-Related Actions
-    else if (action == "_setVisibility") {
+    case SemanticAction::SET_VISIBILITY: {
         ASTStack.push_back(createNode(NodeType::VISIBILITY, value, line));
+        break;
     }
-    else if (action == "_addMember") {
-        ASTNode* member = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* visibility = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::ADD_MEMBER: {
+        ASTNode* member = popNode();
+        ASTNode* visibility = popNode();
 
         // Check if the stack has the class ID
         if (!ASTStack.empty()) {
-            ASTNode* classNode = ASTStack.back();
+            ASTNode* classNode = topNode();
             ASTNode* memberWithVisibility = makeFamily(NodeType::MEMBER, visibility, member);
             classNode->adoptChildren(memberWithVisibility);
         } else {
             std::cerr << "Error: Class ID not found on stack for _addMember action." << std::endl;
         }
+        break;
     }
 
     // Variable and Type Actions
-    else if (action == "_setVariableId") {
-        ASTStack.push_back(createNode(NodeType::VARIABLE_ID, value, line));
+    case SemanticAction::SET_VARIABLE_ID: {
+        ASTStack.push_back(createNode(NodeType::VARIABLE_ID, value, line, symbol));
+        break;
     }
-    else if (action == "_setVariableType") {
-        ASTStack.push_back(createNode(NodeType::TYPE, value, line));
+    case SemanticAction::SET_VARIABLE_TYPE: {
+        ASTStack.push_back(createNode(NodeType::TYPE, value, line, symbol));
+        break;
     }
-    else if (action == "_createVariable") {
+    case SemanticAction::CREATE_VARIABLE: {
         ASTNode* variable;
-        if(ASTStack.back()->getNodeEnum() == NodeType::ARRAY_TYPE){
-            ASTNode* array_type = ASTStack.back(); ASTStack.pop_back();
+        if(topNode()->getNodeEnum() == NodeType::ARRAY_TYPE){
+            ASTNode* array_type = popNode();
             ASTNode* type = array_type->getLeftMostChild();
             ASTNode* array_dimension_list  = array_type->getRightSibling();
-            ASTNode* id = ASTStack.back(); ASTStack.pop_back();
+            ASTNode* id = popNode();
             variable = makeFamily(NodeType::VARIABLE, id, type, array_dimension_list);
         }
         else{
-            ASTNode* type = ASTStack.back(); ASTStack.pop_back();
-            ASTNode* id = ASTStack.back(); ASTStack.pop_back();
+            ASTNode* type = popNode();
+            ASTNode* id = popNode();
             variable = makeFamily(NodeType::VARIABLE, id, type);
         }
 
         ASTStack.push_back(variable);
+        break;
     }
-    else if (action == "_createLocalVariable") {
-        ASTNode* variable = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::CREATE_LOCAL_VARIABLE: {
+        ASTNode* variable = popNode();
         ASTStack.push_back(makeFamily(NodeType::LOCAL_VARIABLE, variable));
+        break;
     }
 
     // Statement Actions
-    else if (action == "_createBlock") {
+    case SemanticAction::CREATE_BLOCK: {
         // ASTNode* statements = ASTStack.back(); ASTStack.pop_back();
         // ASTNode* block = makeFamily(NodeType::BLOCK, statements);
         // ASTStack.push_back(block);
-        ASTStack.back()->setNodeType(NodeType::BLOCK);
+        topNode()->setNodeType(NodeType::BLOCK);
+        break;
     }
-    else if (action == "_createIfStatement") {
-        ASTNode* elsePart = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* thenPart = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* condition = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::CREATE_IF_STATEMENT: {
+        ASTNode* elsePart = popNode();
+        ASTNode* thenPart = popNode();
+        ASTNode* condition = popNode();
         
         ASTNode* ifStmt = makeFamily(NodeType::IF_STATEMENT, condition, thenPart, elsePart);
         ASTStack.push_back(ifStmt);
+        break;
     }
-    else if (action == "_createWhileStatement") {
-        ASTNode* body = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* condition = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::CREATE_WHILE_STATEMENT: {
+        ASTNode* body = popNode();
+        ASTNode* condition = popNode();
         
         ASTNode* whileStmt = makeFamily(NodeType::WHILE_STATEMENT, condition, body);
         ASTStack.push_back(whileStmt);
+        break;
     }
 
     // Expression Actions
-    else if (action == "_createRelationalExpr") {
-        ASTNode* right = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* op = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* left = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::CREATE_RELATIONAL_EXPR: {
+        ASTNode* right = popNode();
+        ASTNode* op = popNode();
+        ASTNode* left = popNode();
         op->adoptChildren(left);
         op->adoptChildren(right);
         //ASTNode* relExpr = makeFamily(NodeType::RELATIONAL_EXPR, op);
         ASTStack.push_back(op);
+        break;
     }
-    else if (action == "_createAssignment") {
-        ASTNode* expr = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* op = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* var = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::CREATE_ASSIGNMENT: {
+        ASTNode* expr = popNode();
+        // The operator node is left out of the tree; the arena frees it with the rest
+        popNode();
+        ASTNode* var = popNode();
         
         ASTNode* assign = makeFamily(NodeType::ASSIGNMENT, var, expr);
         ASTStack.push_back(assign);
-        delete op;
+        break;
     }
-    else if (action == "_createFunctionDeclaration") {
-        ASTNode* signature = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::CREATE_FUNCTION_DECLARATION: {
+        ASTNode* signature = popNode();
         ASTNode* functionDeclaration = makeFamily(NodeType::FUNCTION_DECLARATION, signature);
         ASTStack.push_back(functionDeclaration);
+        break;
     }
-    else if (action == "_createAttribute") {
-        ASTNode* attribute = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::CREATE_ATTRIBUTE: {
+        ASTNode* attribute = popNode();
         ASTStack.push_back(makeFamily(NodeType::ATTRIBUTE, attribute));
+        break;
     }
-    else if (action == "_createSingleStatement") {
-        ASTNode* statement = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::CREATE_SINGLE_STATEMENT: {
+        ASTNode* statement = popNode();
         ASTNode* singleStatement = makeFamily(NodeType::SINGLE_STATEMENT, statement);
         ASTStack.push_back(singleStatement);
+        break;
     }
-    else if (action == "_addStatement") {
-        ASTNode* statement = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* statements = ASTStack.back();
+    case SemanticAction::ADD_STATEMENT: {
+        ASTNode* statement = popNode();
+        ASTNode* statements = topNode();
         statements->adoptChildren(statement);
+        break;
     }
-    else if (action == "_createExpressionStatement") {
+    case SemanticAction::CREATE_EXPRESSION_STATEMENT: {
         // For handling expression statements
         //  ASTNode* expression = ASTStack.back(); ASTStack.pop_back();
         //  ASTNode* expressionStatement = makeFamily(NodeType::EXPRESSION_STATEMENT, expression);
         //  ASTStack.push_back(expressionStatement);
+        break;
     }
-    else if (action == "_createReadStatement") {
-         ASTNode* variable = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::CREATE_READ_STATEMENT: {
+         ASTNode* variable = popNode();
          ASTNode* readStatement = makeFamily(NodeType::READ_STATEMENT, variable);
          ASTStack.push_back(readStatement);
+        break;
     }
-   else if (action == "_createWriteStatement") {
-        ASTNode* expr = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::CREATE_WRITE_STATEMENT: {
+        ASTNode* expr = popNode();
         ASTNode* writeStatement = makeFamily(NodeType::WRITE_STATEMENT, expr);
         ASTStack.push_back(writeStatement);
+        break;
     }
-    else if (action == "_createReturnStatement") {
-            ASTNode* expr = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::CREATE_RETURN_STATEMENT: {
+            ASTNode* expr = popNode();
             ASTNode* returnStatement = makeFamily(NodeType::RETURN_STATEMENT, expr);
             ASTStack.push_back(returnStatement);
+            break;
     }
-    else if (action == "_setAssignOperator") {
+    case SemanticAction::SET_ASSIGN_OPERATOR: {
             ASTNode* assignOp = createNode(NodeType::ASSIGN_OP, value, line);
             ASTStack.push_back(assignOp);
+            break;
     }
-    else if (action == "_setRelop") {
+    case SemanticAction::SET_RELOP: {
             ASTNode* relop = createNode(NodeType::REL_OP, value, line);
             ASTStack.push_back(relop);
+            break;
     }
-    else if (action == "_setAddOp") {
+    case SemanticAction::SET_ADD_OP: {
             ASTNode* addop = createNode(NodeType::ADD_OP, value, line);
             ASTStack.push_back(addop);
+            break;
     }
-    else if (action == "_setMultOp") {
+    case SemanticAction::SET_MULT_OP: {
             ASTNode* multop = createNode(NodeType::MULT_OP, value, line);
             ASTStack.push_back(multop);
+            break;
     }
-    else if (action == "_setIdentifier") {
-            ASTNode* identifier = createNode(NodeType::IDENTIFIER, value, line);
+    case SemanticAction::SET_IDENTIFIER: {
+            ASTNode* identifier = createNode(NodeType::IDENTIFIER, value, line, symbol);
             ASTStack.push_back(identifier);
+            break;
     }
-    else if (action == "_setSelfIdentifier") {
+    case SemanticAction::SET_SELF_IDENTIFIER: {
             ASTNode* selfIdentifier = createNode(NodeType::SELF_IDENTIFIER, "self", line);
             ASTStack.push_back(selfIdentifier);
+            break;
     }
-    else if (action == "_setTypeInt" || action == "_setTypeFloat" || action == "_setTypeCustom" || action == "_setTypeVoid") {
-            ASTNode* typeNode = createNode(NodeType::TYPE, value, line);
+    case SemanticAction::SET_TYPE_INT:
+    case SemanticAction::SET_TYPE_FLOAT:
+    case SemanticAction::SET_TYPE_CUSTOM:
+    case SemanticAction::SET_TYPE_VOID: {
+            ASTNode* typeNode = createNode(NodeType::TYPE, value, line, symbol);
             ASTStack.push_back(typeNode);
+            break;
     }
-    else if (action == "_addArrayDimension") {
+    case SemanticAction::ADD_ARRAY_DIMENSION: {
             ASTNode* arrayDimension = createNode(NodeType::ARRAY_DIMENSION, value, line);
+            arrayDimension->setLiteral(literal);
             ASTStack.push_back(arrayDimension);
+            break;
     }
-    else if (action == "_addDynamicArrayDimension") {
+    case SemanticAction::ADD_DYNAMIC_ARRAY_DIMENSION: {
             ASTNode* dynamicArrayDimension = createNode(NodeType::ARRAY_DIMENSION, "dynamic", line);
             ASTStack.push_back(dynamicArrayDimension);
+            break;
     }
-    else if (action == "_createParamList") {
+    case SemanticAction::CREATE_PARAM_LIST: {
             ASTStack.push_back(createNode(NodeType::PARAM_LIST, "paramList", line));
+            break;
     }
-    else if (action == "_createParam") {
+    case SemanticAction::CREATE_PARAM: {
             ASTNode* param;
-            if(ASTStack.back()->getNodeEnum() == NodeType::ARRAY_TYPE){
-                ASTNode* array_type = ASTStack.back(); ASTStack.pop_back();
+            if(topNode()->getNodeEnum() == NodeType::ARRAY_TYPE){
+                ASTNode* array_type = popNode();
                 ASTNode* type = array_type->getLeftMostChild();
                 ASTNode* array_dimension_list  = array_type->getRightSibling();
-                ASTNode* id = ASTStack.back(); ASTStack.pop_back();
+                ASTNode* id = popNode();
                 param = makeFamily(NodeType::PARAM, id, type, array_dimension_list);
             }
             else{
-                ASTNode* type = ASTStack.back(); ASTStack.pop_back();
-                ASTNode* id = ASTStack.back(); ASTStack.pop_back();
+                ASTNode* type = popNode();
+                ASTNode* id = popNode();
                 param = makeFamily(NodeType::PARAM, id, type);
             }
 
             // Get the parameter list node
-            ASTNode* paramList = ASTStack.back();
+            ASTNode* paramList = topNode();
 
             // Add the formal parameter to the list
             paramList->adoptChildren(param);
+            break;
     }
-    else if (action == "_setParamId"){
-            ASTStack.push_back(createNode(NodeType::PARAM_ID, value, line));
+    case SemanticAction::SET_PARAM_ID: {
+            ASTStack.push_back(createNode(NodeType::PARAM_ID, value, line, symbol));
+            break;
     }
-    else if (action == "_addActualParam") {
-            ASTNode* expr = ASTStack.back(); ASTStack.pop_back();
-            ASTNode* actualParamsList = ASTStack.back();
+    case SemanticAction::ADD_ACTUAL_PARAM: {
+            ASTNode* expr = popNode();
+            ASTNode* actualParamsList = topNode();
             actualParamsList->adoptChildren(expr);
+            break;
     }
-    else if (action == "_createFunctionCall") {
-            ASTNode* params = ASTStack.back(); ASTStack.pop_back();
-            ASTNode* id = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::CREATE_FUNCTION_CALL: {
+            ASTNode* params = popNode();
+            ASTNode* id = popNode();
             ASTNode* functionCall = makeFamily(NodeType::FUNCTION_CALL, id, params);
             ASTStack.push_back(functionCall);
+            break;
     }
-    else if (action == "_processIndexList") {
-            if (ASTStack.at(ASTStack.size() - 2)->getNodeEnum() == NodeType::INDEX_LIST) {
-                ASTNode* index = ASTStack.back(); ASTStack.pop_back();
-                ASTStack.back()->adoptChildren(index);
+    case SemanticAction::PROCESS_INDEX_LIST: {
+            if (topNode(1)->getNodeEnum() == NodeType::INDEX_LIST) {
+                ASTNode* index = popNode();
+                topNode()->adoptChildren(index);
             }
             else {
                 ASTNode* indexList = createNode(NodeType::INDEX_LIST, "indexList", line);
-                ASTNode* index = ASTStack.back(); ASTStack.pop_back();
+                ASTNode* index = popNode();
                 indexList->adoptChildren(index);
                 ASTStack.push_back(indexList);
             }
+            break;
     }
-    else if (action == "_pushIdentifier") {
-            ASTNode* identifier = createNode(NodeType::IDENTIFIER, value, line);
+    case SemanticAction::PUSH_IDENTIFIER: {
+            ASTNode* identifier = createNode(NodeType::IDENTIFIER, value, line, symbol);
             ASTStack.push_back(identifier);
+            break;
     }
-    else if (action == "_pushDotIdentifier") {
-            ASTNode* dotIdentifier = createNode(NodeType::DOT_IDENTIFIER, value, line);
+    case SemanticAction::PUSH_DOT_IDENTIFIER: {
+            ASTNode* dotIdentifier = createNode(NodeType::DOT_IDENTIFIER, value, line, symbol);
             ASTStack.push_back(dotIdentifier);
+            break;
     }
-    else if (action ==  "_finishVariable") {
+    case SemanticAction::FINISH_VARIABLE: {
             // For handling the completion of a variable node
-            ASTNode* identifier = ASTStack.back(); ASTStack.pop_back();
+            ASTNode* identifier = popNode();
             ASTNode* variableNode = makeFamily(NodeType::VARIABLE, identifier);
             ASTStack.push_back(variableNode);
+            break;
     }
-    else if (action == "_finishFactor") {
+    case SemanticAction::FINISH_FACTOR: {
             // For handling the completion of a factor node
             // ASTNode* identifier = ASTStack.back(); ASTStack.pop_back();
             // ASTNode* factorNode = makeFamily(NodeType::FACTOR, identifier);
             // ASTStack.push_back(factorNode);
+            break;
     }
-    else if (action == "_addTerm") {
+    case SemanticAction::ADD_TERM: {
         // // For handling the completion of a term node
         // ASTNode* factor = ASTStack.back(); ASTStack.pop_back();
         
@@ -484,8 +603,9 @@ void AST::performAction(std::string action, std::string value, int line) {
         //     ASTNode* termNode = makeFamily(NodeType::TERM, factor);
         //     ASTStack.push_back(termNode);
         // }
+        break;
     }
-    else if (action == "_finishArithExpr") {
+    case SemanticAction::FINISH_ARITH_EXPR: {
         // // For handling the completion of an arithmetic expression node
         // ASTNode* term = ASTStack.back(); ASTStack.pop_back();
         
@@ -499,8 +619,9 @@ void AST::performAction(std::string action, std::string value, int line) {
         //     ASTNode* arithExprNode = makeFamily(NodeType::ARITH_EXPR, term);
         //     ASTStack.push_back(arithExprNode);
         // }
+        break;
     }
-    else if (action == "_finishExpression") {
+    case SemanticAction::FINISH_EXPRESSION: {
         // // For handling the completion of an expression node
         // ASTNode* arithExpr = ASTStack.back(); ASTStack.pop_back();
         
@@ -514,34 +635,39 @@ void AST::performAction(std::string action, std::string value, int line) {
         //     ASTNode* exprNode = makeFamily(NodeType::EXPR, arithExpr);
         //     ASTStack.push_back(exprNode);
         // }
+        break;
     }
-    else if (action == "_processDotAccess") {
-        if (ASTStack.back()->getNodeEnum() != NodeType::DOT_IDENTIFIER && ASTStack.back()->getNodeEnum() != NodeType::FUNCTION_CALL && (ASTStack.back()->getNodeEnum() != NodeType::ARRAY_ACCESS || ASTStack.at(ASTStack.size() - 2)->getNodeEnum() != NodeType::IDENTIFIER)) {
+    case SemanticAction::PROCESS_DOT_ACCESS: {
+        if (topNode()->getNodeEnum() != NodeType::DOT_IDENTIFIER && topNode()->getNodeEnum() != NodeType::FUNCTION_CALL && (topNode()->getNodeEnum() != NodeType::ARRAY_ACCESS || topNode(1)->getNodeEnum() != NodeType::IDENTIFIER)) {
             return;
         }
-        ASTNode* identifier = ASTStack.back(); ASTStack.pop_back();// Create DOT_IDENTIFIER node
-        ASTNode* left = ASTStack.back(); ASTStack.pop_back(); // Get the left-hand side
+        ASTNode* identifier = popNode();// Create DOT_IDENTIFIER node
+        ASTNode* left = popNode(); // Get the left-hand side
 
         // Create a new node to represent the dot access (e.g., DOT_ACCESS)
         ASTNode* dotAccess = makeFamily(NodeType::DOT_ACCESS, left, identifier);
 
         ASTStack.push_back(dotAccess); // Push the result onto the stack
+        break;
     }
-    else if (action == "_addBodyStatement") {
-        ASTNode* statement = ASTStack.back(); ASTStack.pop_back(); // Get the statement
+    case SemanticAction::ADD_BODY_STATEMENT: {
+        ASTNode* statement = popNode(); // Get the statement
     
-        ASTStack.back()->adoptChildren(statement); // Add the statement to the block
+        topNode()->adoptChildren(statement); // Add the statement to the block
+        break;
     }
-    else if (action == "_addStatementsList"){
+    case SemanticAction::ADD_STATEMENTS_LIST: {
         ASTStack.push_back(createNode(NodeType::STATEMENTS_LIST, "", line));
+        break;
     }
-    else if (action == "_createImplementationList"){
+    case SemanticAction::CREATE_IMPLEMENTATION_LIST: {
         ASTStack.push_back(createNode(NodeType::IMPLEMENTATION_FUNCTION_LIST,"", line));
+        break;
     }
-    else if (action == "_processMultOp"){
-        ASTNode* right = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* op = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* left = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::PROCESS_MULT_OP: {
+        ASTNode* right = popNode();
+        ASTNode* op = popNode();
+        ASTNode* left = popNode();
         
         // Directly connect operands to the operator node  
         op->adoptChildren(left);
@@ -549,11 +675,12 @@ void AST::performAction(std::string action, std::string value, int line) {
         
         // Don't wrap in TERM, push the op node directly
         ASTStack.push_back(op);
+        break;
     }
-    else if (action == "_processAddOp"){
-        ASTNode* right = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* op = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* left = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::PROCESS_ADD_OP: {
+        ASTNode* right = popNode();
+        ASTNode* op = popNode();
+        ASTNode* left = popNode();
         
         // Directly connect operands to the operator node
         op->adoptChildren(left);
@@ -561,20 +688,23 @@ void AST::performAction(std::string action, std::string value, int line) {
         
         // Don't wrap in TERM, push the op node directly
         ASTStack.push_back(op);
+        break;
     }
-    else if (action == "_addCondition"){
-        ASTNode* condition = ASTStack.back(); ASTStack.pop_back();
+    case SemanticAction::ADD_CONDITION: {
+        ASTNode* condition = popNode();
         ASTStack.push_back(makeFamily(NodeType::CONDITION, condition));
+        break;
     }
-    else if(action == "_addEmptyBlock"){
+    case SemanticAction::ADD_EMPTY_BLOCK: {
         // ASTStack.push_back(createNode(NodeType::BLOCK, "empty", line));
+        break;
     }
-    else if(action == "_processArraySize"){
+    case SemanticAction::PROCESS_ARRAY_SIZE: {
         
         // Get all indices from the stack (in reverse order since we're popping from the end)
         ASTNode* dimListNode = createNode(NodeType::DIM_LIST, "dimList", line);
-        while (!ASTStack.empty() && (ASTStack.back()->getNodeEnum() != NodeType::TYPE)) {
-            ASTNode* dim = ASTStack.back(); ASTStack.pop_back();
+        while (!ASTStack.empty() && (topNode()->getNodeEnum() != NodeType::TYPE)) {
+            ASTNode* dim = popNode();
             dimListNode->adoptChildren(dim);
         }
         
@@ -584,28 +714,36 @@ void AST::performAction(std::string action, std::string value, int line) {
             return;
         }
         
-        ASTNode* arrayType = ASTStack.back();
-        ASTStack.pop_back();
+        ASTNode* arrayType = popNode();
         // Push the completed array access node back onto the stack
         ASTStack.push_back(makeFamily(NodeType::ARRAY_TYPE, arrayType, dimListNode));
+        break;
     }
-    else if (action == "_pushIntLiteral") {
+    case SemanticAction::PUSH_INT_LITERAL: {
         ASTNode* intNode = createNode(NodeType::INT, value, line);
+        intNode->setLiteral(literal);
         ASTStack.push_back(intNode);
+        break;
     }
-    else if (action == "_pushFloatLiteral") {
+    case SemanticAction::PUSH_FLOAT_LITERAL: {
         ASTNode* floatNode = createNode(NodeType::FLOAT, value, line);
+        floatNode->setLiteral(literal);
         ASTStack.push_back(floatNode);
+        break;
     }
-    else if (action == "_processArrayAccess") {
+    case SemanticAction::PROCESS_ARRAY_ACCESS: {
         
-        if (ASTStack.back()->getNodeEnum() == NodeType::INDEX_LIST) {
+        if (topNode()->getNodeEnum() == NodeType::INDEX_LIST) {
                     // Get all indices from the stack (in reverse order since we're popping from the end)
-        ASTNode* indexListNode = ASTStack.back(); ASTStack.pop_back();
-        ASTNode* arrayIdentifier = ASTStack.back(); ASTStack.pop_back();
+        ASTNode* indexListNode = popNode();
+        ASTNode* arrayIdentifier = popNode();
         // Push the completed array access node back onto the stack
         ASTStack.push_back(makeFamily(NodeType::ARRAY_ACCESS, arrayIdentifier, indexListNode));     
         } else;
+        break;
+    }
+    case SemanticAction::NONE:
+    case SemanticAction::COUNT:
+        break;
     }
-
 }
\ No newline at end of file
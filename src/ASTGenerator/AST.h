@@ -1,12 +1,17 @@
 #ifndef AST_H
 #define AST_H
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <stack>
 #include <vector>
 #include <iostream>
 #include <fstream>
+#include <memory>
 #include <ASTGenerator/ASTNode.h>
+#include <ASTGenerator/ASTArena.h>
+#include <ASTGenerator/SemanticAction.h>
 
 /**
  * @class AST
@@ -29,6 +34,33 @@ private:
      * @brief Stack used to track nodes during tree traversal and construction.
      */
     std::vector<ASTNode*> ASTStack;
+
+    /**
+     * @var ownArena
+     * @brief Arena of the nodes, unless they are allocated from another one.
+     */
+    std::unique_ptr<ASTArena> ownArena;
+
+    /**
+     * @var arena
+     * @brief Arena the nodes are allocated from, or nullptr until an own arena is needed again.
+     */
+    ASTArena* arena;
+
+    /**
+     * @brief Pops the top node of the semantic stack.
+     * @return The popped node.
+     * @throws std::runtime_error If the stack is empty or only the root is left.
+     */
+    ASTNode* popNode();
+
+    /**
+     * @brief Gets a node of the semantic stack without popping it.
+     * @param depth Number of nodes above the requested one.
+     * @return The node at the given depth.
+     * @throws std::runtime_error If the stack holds no node at that depth.
+     */
+    ASTNode* topNode(size_t depth = 0) const;
     
 public:
     /**
@@ -37,9 +69,46 @@ public:
     AST();
     
     /**
-     * @brief Destroys the AST object and frees all allocated memory.
+     * @brief Destroys the AST object and, unless they live in another arena, its nodes.
      */
     ~AST();
+
+    /**
+     * @brief Takes over the nodes of another AST, and its arena if it owns one.
+     *
+     * The moved-from AST is left empty. If its arena was its own, it gets a
+     * new one when it next creates a node; an external arena stays shared.
+     *
+     * @param other The AST to move from.
+     */
+    AST(AST&& other) noexcept;
+
+    /**
+     * @brief Replaces this AST with another one, as the move constructor does.
+     * @param other The AST to move from.
+     * @return This AST.
+     */
+    AST& operator=(AST&& other) noexcept;
+
+    /**
+     * @brief Allocates the nodes of this AST from the given arena instead of its own.
+     *
+     * The nodes then live as long as the arena, usually the compilation
+     * session's, rather than as long as this AST.
+     *
+     * @param arena The arena; must be set before any node is created.
+     */
+    void setArena(ASTArena* arena) { this->arena = arena; }
+
+    /**
+     * @brief Retrieves the arena the nodes are allocated from.
+     */
+    ASTArena& getArena();
+
+    /**
+     * @brief Empties the AST, freeing its nodes unless they live in another arena.
+     */
+    void clear();
     
     // /**
     //  * @brief Creates a new AST node with the specified type and value.
@@ -54,9 +123,10 @@ public:
      * @param nodeType The type of node to create.
      * @param nodeValue The value to store in the node.
      * @param line The line number associated with the node.
+     * @param symbol Interned identifier of the value, if it is one.
      * @return Pointer to the newly created ASTNode.
      */
-    ASTNode* createNode(NodeType nodeType, std::string nodeValue, int line = 0);
+    ASTNode* createNode(NodeType nodeType, std::string_view nodeValue, int line = 0, SymbolId symbol = NO_SYMBOL);
     
     /**
      * @brief Writes the AST structure to a specified file.
@@ -64,13 +134,24 @@ public:
      */
     void writeToFile(std::string filename);
     
+    /**
+     * @brief Looks up the semantic action with the given name.
+     * @param name Name of an action symbol in the grammar, e.g. "_createRoot".
+     * @return The action, or SemanticAction::NONE if the name is not one this AST implements.
+     */
+    static SemanticAction resolveAction(std::string_view name);
+
     /**
      * @brief Performs a specified action on the AST.
-     * @param action String representing the action to be performed.
-     * @param value String representing the value to be used in the action.
+     * @param action The action to be performed, as resolved by resolveAction().
+     * @param value The lexeme to be used in the action; copied only into the nodes that keep it.
      * @param line The line number associated with the action.
+     * @param symbol Interned identifier of the value, if the value is an identifier.
+     * @param literal Decoded value of the value, if the value is a numeric literal.
+     * @throws std::runtime_error If the action needs more nodes than the semantic stack holds.
      */
-    void performAction(std::string action, std::string value, int line);
+    void performAction(SemanticAction action, std::string_view value, int line, SymbolId symbol = NO_SYMBOL,
+                       LiteralValue literal = LiteralValue());
     
     /**
      * @brief Creates a family node structure with a parent and two children.
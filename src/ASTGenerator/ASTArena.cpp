@@ -0,0 +1,36 @@
+/**
+ * @file ASTArena.cpp
+ * @brief Implementation of the AST node arena.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#include "ASTArena.h"
+#include <type_traits>
+
+ASTArena::~ASTArena() {
+    release();
+}
+
+void ASTArena::addBlock() {
+    blocks.push_back(std::make_unique<Slot[]>(NODES_PER_BLOCK));
+    used = 0;
+}
+
+void ASTArena::release() {
+    // Node values and metadata own heap memory, so the nodes are destroyed in
+    // one forward sweep; every block but the last is full.
+    if constexpr (!std::is_trivially_destructible_v<ASTNode>) {
+        for (size_t b = 0; b < blocks.size(); ++b) {
+            const size_t count = b + 1 == blocks.size() ? used : NODES_PER_BLOCK;
+            for (size_t i = 0; i < count; ++i) {
+                std::launder(reinterpret_cast<ASTNode*>(&blocks[b][i]))->~ASTNode();
+            }
+        }
+    }
+    blocks.clear();
+    used = 0;
+    nodeCount = 0;
+    allocatedBytes = 0;
+}
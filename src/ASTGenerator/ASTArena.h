@@ -0,0 +1,92 @@
+/**
+ * @file ASTArena.h
+ * @brief Bump allocator that owns the nodes of one or more ASTs.
+ *
+ * Nodes are carved out of fixed-size blocks in creation order, so the nodes
+ * built for one statement sit next to each other in memory and a traversal
+ * walks mostly forward through a few blocks. Nothing is freed node by node:
+ * release() destroys every node in one sweep over the blocks and returns the
+ * blocks together, so the tree needs no ownership of its own and nodes that
+ * were dropped while building it are reclaimed with the rest.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#ifndef ASTARENA_H
+#define ASTARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+#include "ASTNode.h"
+
+/**
+ * @class ASTArena
+ * @brief Allocates ASTNodes contiguously and frees them all at once.
+ */
+class ASTArena {
+public:
+    static constexpr size_t NODES_PER_BLOCK = 512; ///< Nodes carved out of each block
+
+    ASTArena() = default;
+
+    /**
+     * @brief Destroys every node allocated from the arena.
+     */
+    ~ASTArena();
+
+    ASTArena(const ASTArena&) = delete;
+    ASTArena& operator=(const ASTArena&) = delete;
+
+    /**
+     * @brief Constructs a node in the arena.
+     * @param args Arguments forwarded to the ASTNode constructor.
+     * @return The node, valid until the arena is released or destroyed.
+     */
+    template <typename... Args>
+    ASTNode* create(Args&&... args) {
+        if (blocks.empty() || used == NODES_PER_BLOCK) {
+            addBlock();
+        }
+        ASTNode* node = new (&blocks.back()[used]) ASTNode(std::forward<Args>(args)...);
+        used++;
+        nodeCount++;
+        allocatedBytes += sizeof(ASTNode);
+        return node;
+    }
+
+    /**
+     * @brief Destroys every node and frees the blocks; the arena can then be reused.
+     */
+    void release();
+
+    /// Retrieves the number of nodes allocated since the arena was created or released.
+    size_t getNodeCount() const { return nodeCount; }
+
+    /// Retrieves the bytes of node storage handed out since the arena was created or released.
+    size_t getAllocatedBytes() const { return allocatedBytes; }
+
+    /// Retrieves the bytes of the blocks the arena holds.
+    size_t getReservedBytes() const { return blocks.size() * NODES_PER_BLOCK * sizeof(ASTNode); }
+
+private:
+    /// Uninitialized storage for one node.
+    struct alignas(ASTNode) Slot {
+        std::byte bytes[sizeof(ASTNode)];
+    };
+
+    std::vector<std::unique_ptr<Slot[]>> blocks; ///< Blocks in allocation order
+    size_t used = 0;                             ///< Slots taken in the last block
+    size_t nodeCount = 0;                        ///< Nodes constructed in all blocks
+    size_t allocatedBytes = 0;                   ///< Bytes of node storage handed out
+
+    /**
+     * @brief Appends an empty block.
+     */
+    void addBlock();
+};
+
+#endif // ASTARENA_H
@@ -2,7 +2,7 @@
 #include "Semantics/Visitor.h"
 #include <iostream>
 
-int ASTNode::nodeCount = 0;
+std::atomic<int> ASTNode::nodeCount{0};
 
 ASTNode::ASTNode()
     : leftMostChild(nullptr),
@@ -11,9 +11,8 @@ ASTNode::ASTNode()
       parent(nullptr),
       nodeType(NodeType::EMPTY),
       nodeValue(""),
-      nodeNumber(nodeCount)
+      nodeNumber(nodeCount++)
 {
-    nodeCount++;
 }
 
 ASTNode::ASTNode(NodeType nodeType, std::string nodeValue)
@@ -23,9 +22,8 @@ ASTNode::ASTNode(NodeType nodeType, std::string nodeValue)
       parent(nullptr),
       nodeType(nodeType),
       nodeValue(nodeValue),
-      nodeNumber(nodeCount)   
+      nodeNumber(nodeCount++)
 {
-    nodeCount++;
 }
 
 ASTNode::~ASTNode()
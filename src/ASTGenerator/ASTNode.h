@@ -6,8 +6,11 @@
 #ifndef ASTNODE_H
 #define ASTNODE_H
 
+#include <atomic>
 #include <string>
 #include <unordered_map>
+#include "Scanner/StringInterner.h"
+#include "Scanner/Token.h"
 
 /**
  * @enum NodeType
@@ -100,8 +103,10 @@ private:
     NodeType nodeType;        ///< Type of this AST node.
     std::string nodeValue;    ///< Value or content of this AST node.
     int nodeNumber;           ///< Unique number assigned to this node.
-    static int nodeCount;     ///< Counter for generating unique node numbers.
+    static std::atomic<int> nodeCount; ///< Counter for generating unique node numbers; shared by parsers on every thread.
     int lineNumber = 0;       ///< Line number in the source code
+    SymbolId symbolId = NO_SYMBOL; ///< Interned identifier of the node value, if any
+    LiteralValue literal;     ///< Decoded value of an integer or float literal node
     std::unordered_map<std::string, std::string> metadata;
 
 public:
@@ -205,6 +210,30 @@ public:
      */
     int getNodeNumber() const { return nodeNumber; }
 
+    /**
+     * @brief Gets the interned identifier of the node value.
+     * @return The symbol ID, or NO_SYMBOL if the value is not an interned identifier.
+     */
+    SymbolId getSymbolId() const { return symbolId; }
+
+    /**
+     * @brief Sets the interned identifier of the node value.
+     * @param id The symbol ID.
+     */
+    void setSymbolId(SymbolId id) { symbolId = id; }
+
+    /**
+     * @brief Gets the decoded value of a literal node.
+     * @return The value the scanner decoded for an INT, FLOAT or sized ARRAY_DIMENSION node.
+     */
+    const LiteralValue& getLiteral() const { return literal; }
+
+    /**
+     * @brief Sets the decoded value of a literal node.
+     * @param value The literal value.
+     */
+    void setLiteral(const LiteralValue& value) { literal = value; }
+
     /**
      * @brief Adds a child node to this node.
      * @param child Pointer to the child node to be added.
@@ -0,0 +1,193 @@
+/**
+ * @file SemanticAction.h
+ * @brief Semantic actions of the attribute grammar and the names they are written with.
+ *
+ * Kept apart from the AST so that the build-time parser generator can check
+ * action names without linking the tree code.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#ifndef SEMANTICACTION_H
+#define SEMANTICACTION_H
+
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+/**
+ * @enum SemanticAction
+ * @brief Identifies a semantic action of the attribute grammar.
+ *
+ * Action symbols are resolved to these values once, when a parser is set up,
+ * so AST::performAction() dispatches on an integer instead of comparing names.
+ */
+enum class SemanticAction : uint8_t {
+    NONE, ///< An action this AST does not implement; performing it does nothing
+    CREATE_ROOT,
+    ADD_TO_PROGRAM,
+    CREATE_CLASS_ID,
+    CREATE_INHERITANCE_LIST,
+    ADD_INHERITANCE_ID,
+    CREATE_CLASS,
+    ADD_MEMBER_LIST,
+    CREATE_IMPLEMENTATION_ID,
+    ADD_IMPLEMENTATION_FUNCTION,
+    CREATE_IMPLEMENTATION,
+    CREATE_FUNCTION_ID,
+    SET_CONSTRUCTOR,
+    CREATE_FUNCTION_SIGNATURE,
+    CREATE_CONSTRUCTOR_SIGNATURE,
+    CREATE_FUNCTION_BODY,
+    CREATE_FUNCTION,
+    SET_VISIBILITY,
+    ADD_MEMBER,
+    SET_VARIABLE_ID,
+    SET_VARIABLE_TYPE,
+    CREATE_VARIABLE,
+    CREATE_LOCAL_VARIABLE,
+    CREATE_BLOCK,
+    CREATE_IF_STATEMENT,
+    CREATE_WHILE_STATEMENT,
+    CREATE_RELATIONAL_EXPR,
+    CREATE_ASSIGNMENT,
+    CREATE_FUNCTION_DECLARATION,
+    CREATE_ATTRIBUTE,
+    CREATE_SINGLE_STATEMENT,
+    ADD_STATEMENT,
+    CREATE_EXPRESSION_STATEMENT,
+    CREATE_READ_STATEMENT,
+    CREATE_WRITE_STATEMENT,
+    CREATE_RETURN_STATEMENT,
+    SET_ASSIGN_OPERATOR,
+    SET_RELOP,
+    SET_ADD_OP,
+    SET_MULT_OP,
+    SET_IDENTIFIER,
+    SET_SELF_IDENTIFIER,
+    SET_TYPE_INT,
+    SET_TYPE_FLOAT,
+    SET_TYPE_CUSTOM,
+    SET_TYPE_VOID,
+    ADD_ARRAY_DIMENSION,
+    ADD_DYNAMIC_ARRAY_DIMENSION,
+    CREATE_PARAM_LIST,
+    CREATE_PARAM,
+    SET_PARAM_ID,
+    ADD_ACTUAL_PARAM,
+    CREATE_FUNCTION_CALL,
+    PROCESS_INDEX_LIST,
+    PUSH_IDENTIFIER,
+    PUSH_DOT_IDENTIFIER,
+    FINISH_VARIABLE,
+    FINISH_FACTOR,
+    ADD_TERM,
+    FINISH_ARITH_EXPR,
+    FINISH_EXPRESSION,
+    PROCESS_DOT_ACCESS,
+    ADD_BODY_STATEMENT,
+    ADD_STATEMENTS_LIST,
+    CREATE_IMPLEMENTATION_LIST,
+    PROCESS_MULT_OP,
+    PROCESS_ADD_OP,
+    ADD_CONDITION,
+    ADD_EMPTY_BLOCK,
+    PROCESS_ARRAY_SIZE,
+    PUSH_INT_LITERAL,
+    PUSH_FLOAT_LITERAL,
+    PROCESS_ARRAY_ACCESS,
+    COUNT
+};
+
+/// Name of each semantic action in the attribute grammar.
+inline constexpr std::pair<std::string_view, SemanticAction> SEMANTIC_ACTION_NAMES[] = {
+    {"_createRoot", SemanticAction::CREATE_ROOT},
+    {"_addToProgram", SemanticAction::ADD_TO_PROGRAM},
+    {"_createClassId", SemanticAction::CREATE_CLASS_ID},
+    {"_createInheritanceList", SemanticAction::CREATE_INHERITANCE_LIST},
+    {"_addInheritanceId", SemanticAction::ADD_INHERITANCE_ID},
+    {"_createClass", SemanticAction::CREATE_CLASS},
+    {"_addMemberList", SemanticAction::ADD_MEMBER_LIST},
+    {"_createImplementationId", SemanticAction::CREATE_IMPLEMENTATION_ID},
+    {"_addImplementationFunction", SemanticAction::ADD_IMPLEMENTATION_FUNCTION},
+    {"_createImplementation", SemanticAction::CREATE_IMPLEMENTATION},
+    {"_createFunctionId", SemanticAction::CREATE_FUNCTION_ID},
+    {"_setConstructor", SemanticAction::SET_CONSTRUCTOR},
+    {"_createFunctionSignature", SemanticAction::CREATE_FUNCTION_SIGNATURE},
+    {"_createConstructorSignature", SemanticAction::CREATE_CONSTRUCTOR_SIGNATURE},
+    {"_createFunctionBody", SemanticAction::CREATE_FUNCTION_BODY},
+    {"_createFunction", SemanticAction::CREATE_FUNCTION},
+    {"_setVisibility", SemanticAction::SET_VISIBILITY},
+    {"_addMember", SemanticAction::ADD_MEMBER},
+    {"_setVariableId", SemanticAction::SET_VARIABLE_ID},
+    {"_setVariableType", SemanticAction::SET_VARIABLE_TYPE},
+    {"_createVariable", SemanticAction::CREATE_VARIABLE},
+    {"_createLocalVariable", SemanticAction::CREATE_LOCAL_VARIABLE},
+    {"_createBlock", SemanticAction::CREATE_BLOCK},
+    {"_createIfStatement", SemanticAction::CREATE_IF_STATEMENT},
+    {"_createWhileStatement", SemanticAction::CREATE_WHILE_STATEMENT},
+    {"_createRelationalExpr", SemanticAction::CREATE_RELATIONAL_EXPR},
+    {"_createAssignment", SemanticAction::CREATE_ASSIGNMENT},
+    {"_createFunctionDeclaration", SemanticAction::CREATE_FUNCTION_DECLARATION},
+    {"_createAttribute", SemanticAction::CREATE_ATTRIBUTE},
+    {"_createSingleStatement", SemanticAction::CREATE_SINGLE_STATEMENT},
+    {"_addStatement", SemanticAction::ADD_STATEMENT},
+    {"_createExpressionStatement", SemanticAction::CREATE_EXPRESSION_STATEMENT},
+    {"_createReadStatement", SemanticAction::CREATE_READ_STATEMENT},
+    {"_createWriteStatement", SemanticAction::CREATE_WRITE_STATEMENT},
+    {"_createReturnStatement", SemanticAction::CREATE_RETURN_STATEMENT},
+    {"_setAssignOperator", SemanticAction::SET_ASSIGN_OPERATOR},
+    {"_setRelop", SemanticAction::SET_RELOP},
+    {"_setAddOp", SemanticAction::SET_ADD_OP},
+    {"_setMultOp", SemanticAction::SET_MULT_OP},
+    {"_setIdentifier", SemanticAction::SET_IDENTIFIER},
+    {"_setSelfIdentifier", SemanticAction::SET_SELF_IDENTIFIER},
+    {"_setTypeInt", SemanticAction::SET_TYPE_INT},
+    {"_setTypeFloat", SemanticAction::SET_TYPE_FLOAT},
+    {"_setTypeCustom", SemanticAction::SET_TYPE_CUSTOM},
+    {"_setTypeVoid", SemanticAction::SET_TYPE_VOID},
+    {"_addArrayDimension", SemanticAction::ADD_ARRAY_DIMENSION},
+    {"_addDynamicArrayDimension", SemanticAction::ADD_DYNAMIC_ARRAY_DIMENSION},
+    {"_createParamList", SemanticAction::CREATE_PARAM_LIST},
+    {"_createParam", SemanticAction::CREATE_PARAM},
+    {"_setParamId", SemanticAction::SET_PARAM_ID},
+    {"_addActualParam", SemanticAction::ADD_ACTUAL_PARAM},
+    {"_createFunctionCall", SemanticAction::CREATE_FUNCTION_CALL},
+    {"_processIndexList", SemanticAction::PROCESS_INDEX_LIST},
+    {"_pushIdentifier", SemanticAction::PUSH_IDENTIFIER},
+    {"_pushDotIdentifier", SemanticAction::PUSH_DOT_IDENTIFIER},
+    {"_finishVariable", SemanticAction::FINISH_VARIABLE},
+    {"_finishFactor", SemanticAction::FINISH_FACTOR},
+    {"_addTerm", SemanticAction::ADD_TERM},
+    {"_finishArithExpr", SemanticAction::FINISH_ARITH_EXPR},
+    {"_finishExpression", SemanticAction::FINISH_EXPRESSION},
+    {"_processDotAccess", SemanticAction::PROCESS_DOT_ACCESS},
+    {"_addBodyStatement", SemanticAction::ADD_BODY_STATEMENT},
+    {"_addStatementsList", SemanticAction::ADD_STATEMENTS_LIST},
+    {"_createImplementationList", SemanticAction::CREATE_IMPLEMENTATION_LIST},
+    {"_processMultOp", SemanticAction::PROCESS_MULT_OP},
+    {"_processAddOp", SemanticAction::PROCESS_ADD_OP},
+    {"_addCondition", SemanticAction::ADD_CONDITION},
+    {"_addEmptyBlock", SemanticAction::ADD_EMPTY_BLOCK},
+    {"_processArraySize", SemanticAction::PROCESS_ARRAY_SIZE},
+    {"_pushIntLiteral", SemanticAction::PUSH_INT_LITERAL},
+    {"_pushFloatLiteral", SemanticAction::PUSH_FLOAT_LITERAL},
+    {"_processArrayAccess", SemanticAction::PROCESS_ARRAY_ACCESS},
+};
+
+/**
+ * @brief Resolves the name of an action symbol, e.g. "_createRoot".
+ * @param name The action symbol as written in the grammar.
+ * @return The action, or SemanticAction::NONE if the name is not one the AST implements.
+ */
+inline SemanticAction resolveSemanticAction(std::string_view name) {
+    for (const auto& [actionName, action] : SEMANTIC_ACTION_NAMES) {
+        if (actionName == name) {
+            return action;
+        }
+    }
+    return SemanticAction::NONE;
+}
+
+#endif // SEMANTICACTION_H
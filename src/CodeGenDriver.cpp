@@ -3,6 +3,7 @@
 #include "CodeGenerator/MemSizeVisitor.h"
 #include "CodeGenerator/CodeGenVisitor.h"
 #include "Parser/Parser.h"
+#include "Session/CompilationSession.h"
 #include <iostream>
 #include <string>
 #include <vector>
@@ -13,7 +14,7 @@ namespace fs = std::filesystem;
 void printUsage(const std::string& programName) {
     std::cout << "Usage: " << programName << " [options] file\n"
               << "Options:\n"
-              << "  -t, --table <csv_file>   Specify a custom parsing table CSV file. Default is 'attribute_grammar_parsing_table.csv'.\n"
+              << "  -t, --table <csv_file>   Specify a custom parsing table CSV file. Default is the built-in attribute grammar table.\n"
               << "  -o, --output <dir>       Specify output directory for generated files. Default is current directory.\n"
               << "  -h, --help               Show this help message.\n";
 }
@@ -24,7 +25,7 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    std::string tableFile = "attribute_grammar_parsing_table.csv";
+    std::string tableFile; // Empty: the attribute grammar table compiled into the program
     std::string outputDir = ".";
     std::string inputFile;
 
@@ -70,8 +71,11 @@ int main(int argc, char* argv[]) {
     std::cout << "Processing file: " << inputFile << std::endl;
 
     // First parse the file to generate AST
-    std::cout << "Parsing file: " << inputFile << " with table: " << tableFile << std::endl;
+    std::cout << "Parsing file: " << inputFile << " with table: " << (tableFile.empty() ? "built-in" : tableFile) << std::endl;
+    CompilationSession session;
     Parser parser(inputFile, tableFile);
+    parser.setInterner(&session.getInterner());
+    parser.setArena(&session.getArena());
 
     bool parseSuccess = parser.parse();
     if (!parseSuccess) {
@@ -86,6 +90,8 @@ int main(int argc, char* argv[]) {
     // Phase 1: Symbol Table Generation
     std::cout << "Generating symbol table..." << std::endl;
     SymbolTableVisitor symbolTableVisitor;
+    symbolTableVisitor.setLineIndex(parser.getLineIndex());
+    symbolTableVisitor.setInterner(&session.getInterner());
     root->accept(&symbolTableVisitor);
 
     // Output the symbol table to file
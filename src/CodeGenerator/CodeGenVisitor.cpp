@@ -282,7 +282,7 @@ void CodeGenVisitor::visitInt(ASTNode *node)
     int reg = allocateRegister();
 
     // Get the integer value
-    int value = std::stoi(node->getNodeValue());
+    int value = node->getLiteral().intValue;
 
     // Get metadata that was set by MemSizeVisitor
     std::string tempVarName = node->getMetadata("moonVarName");
@@ -329,7 +329,7 @@ void CodeGenVisitor::visitFloat(ASTNode *node)
     int reg = allocateRegister();
 
     // Get the float value
-    float value = std::stof(node->getNodeValue());
+    float value = node->getLiteral().floatValue;
     int intValue = static_cast<int>(value);
 
     // Get metadata that was set by MemSizeVisitor
@@ -909,7 +909,7 @@ void CodeGenVisitor::visitArrayAccess(ASTNode *node)
         
         // Extract class name from the object node
         if (objectNode && objectNode->getNodeEnum() == NodeType::IDENTIFIER) {
-            auto objSymbol = currentTable->lookupSymbol(objectNode->getNodeValue());
+            auto objSymbol = currentTable->lookupSymbol(objectNode->getSymbolId(), objectNode->getNodeValue());
             if (objSymbol) {
                 className = objSymbol->getType();
             }
@@ -1047,7 +1047,7 @@ void CodeGenVisitor::visitIndexList(ASTNode *node)
     // For now, assume it's primarily an IDENTIFIER.
     if (arrayBaseNode->getNodeEnum() == NodeType::IDENTIFIER)
     {
-        arraySymbol = currentTable->lookupSymbol(arrayBaseNode->getNodeValue());
+        arraySymbol = currentTable->lookupSymbol(arrayBaseNode->getSymbolId(), arrayBaseNode->getNodeValue());
         if (arraySymbol)
         {
             dimensions = arraySymbol->getArrayDimensions();
@@ -1086,7 +1086,7 @@ void CodeGenVisitor::visitIndexList(ASTNode *node)
             // Get the class type of the object
             std::string className;
             if (objectNode->getNodeEnum() == NodeType::IDENTIFIER) {
-                auto objSymbol = currentTable->lookupSymbol(objectNode->getNodeValue());
+                auto objSymbol = currentTable->lookupSymbol(objectNode->getSymbolId(), objectNode->getNodeValue());
                 if (objSymbol) {
                     className = objSymbol->getType();
                 }
@@ -2101,7 +2101,7 @@ void CodeGenVisitor::visitFunctionCall(ASTNode *node) {
     std::vector<std::string> paramNames;
     if (!funcSymbols.empty() && functionTable) {
         // Extract parameters as before...
-        std::unordered_map<std::string, std::shared_ptr<Symbol>> symbols = functionTable->getSymbols();
+        std::vector<std::pair<std::string, std::shared_ptr<Symbol>>> symbols = functionTable->getSymbols();
         for (const auto& pair : symbols) {
             std::shared_ptr<Symbol> symbolPtr = pair.second;
             if (symbolPtr->getKind() == SymbolKind::PARAMETER) {
@@ -2163,7 +2163,7 @@ void CodeGenVisitor::visitFunctionCall(ASTNode *node) {
         // Special handling for arrays passed as parameters
         if (param->getNodeEnum() == NodeType::IDENTIFIER) {
             // Check if it's an array by examining its type
-            auto symbol = currentTable->lookupSymbol(param->getNodeValue());
+            auto symbol = currentTable->lookupSymbol(param->getSymbolId(), param->getNodeValue());
             
             if (symbol && !symbol->getArrayDimensions().empty()) {
                 // This is an array - pass its address instead of a value
@@ -2380,7 +2380,7 @@ void CodeGenVisitor::visitDotAccess(ASTNode* node) {
     // Find the object's class type
     std::string objTypeName;
     if (objExpr->getNodeEnum() == NodeType::IDENTIFIER) {
-        auto objSymbol = currentTable->lookupSymbol(objExpr->getNodeValue());
+        auto objSymbol = currentTable->lookupSymbol(objExpr->getSymbolId(), objExpr->getNodeValue());
         if (objSymbol) {
             objTypeName = objSymbol->getType();
         }
@@ -771,7 +771,7 @@ std::string MemSizeVisitor::determineNodeType(ASTNode* node) {
         return "float";
     } else if (node->getNodeEnum() == NodeType::IDENTIFIER) {
         // Look up the identifier in symbol table
-        auto symbol = currentTable->lookupSymbol(node->getNodeValue());
+        auto symbol = currentTable->lookupSymbol(node->getSymbolId(), node->getNodeValue());
         if (symbol) {
             return symbol->getType();
         }
@@ -1250,18 +1250,13 @@ void MemSizeVisitor::visitArrayDimension(ASTNode* node) {
         return;
     }
     
-    // For regular arrays with dimension values stored directly in the node
-    try {
-        int dimension = std::stoi(dimensionValue);
-        if (dimension <= 0) {
-            // Handle invalid dimension (should log an error in a real implementation)
-            currentArrayDimensions.push_back(1); // Default to 1
-        } else {
-            currentArrayDimensions.push_back(dimension);
-        }
-    } catch (const std::exception&) {
-        // If not a number, default to dynamic array
-        currentArrayDimensions.push_back(-1);
+    // For regular arrays, the scanner decoded the dimension literal
+    int dimension = node->getLiteral().intValue;
+    if (dimension <= 0) {
+        // Handle invalid dimension (should log an error in a real implementation)
+        currentArrayDimensions.push_back(1); // Default to 1
+    } else {
+        currentArrayDimensions.push_back(dimension);
     }
 }
 
@@ -4,6 +4,7 @@
 #include "Semantics/SemanticCheckingVisitor.h"
 #include "CodeGenerator/MemSizeVisitor.h"
 #include "CodeGenerator/CodeGenVisitor.h"
+#include "Session/CompilationSession.h"
 #include <iostream>
 #include <string>
 #include <vector>
@@ -40,8 +41,12 @@ const std::map<std::string, CompilerPhase> phaseMap = {
 void printUsage(const std::string& programName) {
     std::cout << "Usage: " << programName << " [options] file\n"
               << "Options:\n"
-              << "  -t, --table <csv_file>   Specify a custom parsing table CSV file. Default is 'attribute_grammar_parsing_table.csv'.\n"
+              << "  -t, --table <csv_file>   Specify a custom parsing table CSV file. Default is the built-in attribute grammar table.\n"
               << "  -o, --output <dir>       Specify output directory for generated files. Default is current directory.\n"
+              << "  -d, --derivation         Write the leftmost derivation to parser_out/<file>.outderivation.\n"
+              << "  -P, --pipeline           Scan on a separate thread while parsing, handing tokens over in batches.\n"
+              << "  -r, --recursive-descent  Parse with the generated recursive-descent parser instead of the table.\n"
+              << "                           It stops at the first syntax error. Requires the built-in table.\n"
               << "  -p, --phase <phase>      Specify the compiler phase to run up to. Options:\n"
               << "                           scan (1): Lexical analysis only\n"
               << "                           parse (2): Syntax analysis\n"
@@ -53,6 +58,11 @@ void printUsage(const std::string& programName) {
 }
 
 // Phase 1: Lexical Analysis
+// The scanner output files are written by a full pass over a copy of the
+// scanner, streaming tokens straight to the files, so they are complete even if
+// a later phase fails. The returned scanner is still at the start of the input:
+// the parser pulls its tokens from it again, on demand or, with --pipeline, on a
+// separate thread.
 Scanner runScannerPhase(const std::string& inputFile) {
     std::cout << "\n=========Phase 1: Lexical Analysis=========" << std::endl;
     
@@ -80,17 +90,18 @@ Scanner runScannerPhase(const std::string& inputFile) {
     std::string outputPath = outputBase.string();
     
     Scanner scanner(inputFile, outputPath);
-    scanner.processFile();
-    scanner.writeOutputsToFile();
+    Scanner outputPass(scanner);
+    outputPass.processFile();
     std::cout << "Lexical analysis completed" << std::endl;
     std::cout << "Scanner output files written to: " << scannerOutDir << std::endl;
     return scanner;
 }
 
 // Phase 2: Syntax Analysis and AST Construction
-AST runParserPhase(const std::string& inputFile, const std::string& tableFile, Scanner& scanner) {
+AST runParserPhase(const std::string& inputFile, const std::string& tableFile, Scanner& scanner,
+                   CompilationSession& session, bool recordDerivation, bool pipelined, bool recursiveDescent) {
     std::cout << "\n=========Phase 2: Syntax Analysis=========" << std::endl;
-    std::cout << "Parsing file: " << inputFile << " with table: " << tableFile << std::endl;
+    std::cout << "Parsing file: " << inputFile << " with table: " << (tableFile.empty() ? "built-in" : tableFile) << std::endl;
     
     // Extract directory and filename
     fs::path inputPath(inputFile);
@@ -116,18 +127,21 @@ AST runParserPhase(const std::string& inputFile, const std::string& tableFile, S
     std::string outputPath = outputBase.string();
     
     Parser parser(inputFile, tableFile, scanner);
+    parser.setArena(&session.getArena());
+    parser.setRecordDerivation(recordDerivation);
+    parser.setPipelined(pipelined);
+    parser.setRecursiveDescent(recursiveDescent);
     bool parseSuccess = parser.parse();
     // Write parser output files to the parser_out directory
     parser.writeOutputFiles(outputPath);
     
     if (!parseSuccess) {
         std::cerr << "Error: Failed to parse " << inputFile << std::endl;
-        AST emptyAST;
-        return emptyAST; // Return empty AST on failure
+        return AST(); // Return empty AST on failure
     }
     
-    // Create a copy of the parser's AST
-    AST ast = parser.getAST();
+    // Take the parser's AST; its nodes live in the session's arena
+    AST ast = std::move(parser.getAST());
     
     std::cout << "Parse successful, AST constructed" << std::endl;
     std::cout << "Parser output files written to: " << parserOutDir << std::endl;
@@ -170,7 +184,8 @@ void runSymbolTablePhase(AST& ast, const std::string& inputFile, SymbolTableVisi
 }
 
 // Phase 4: Semantic Analysis
-bool runSemanticPhase(AST& ast, SymbolTableVisitor& symbolTableVisitor, const std::string& inputFile) {
+bool runSemanticPhase(AST& ast, SymbolTableVisitor& symbolTableVisitor, const std::string& inputFile,
+                      std::shared_ptr<const LineIndex> lineIndex) {
     std::cout << "\n=========Phase 4: Semantic Analysis=========" << std::endl;
     
     // Extract directory and filename
@@ -197,6 +212,7 @@ bool runSemanticPhase(AST& ast, SymbolTableVisitor& symbolTableVisitor, const st
     std::string outputPath = outputBase.string();
     
     SemanticCheckingVisitor semanticChecker(symbolTableVisitor.getGlobalTable());
+    semanticChecker.setLineIndex(lineIndex);
     semanticChecker.importSymbolTableErrors(symbolTableVisitor);
     ast.getRoot()->accept(&semanticChecker);
     
@@ -248,7 +264,7 @@ void runMemoryPhase(AST& ast, const std::string& inputFile, MemSizeVisitor& memS
 }
 
 // Phase 6: Code Generation
-bool runCodeGenPhase(AST ast, std::shared_ptr<SymbolTable> symbolTable, const std::string& inputFile) {
+bool runCodeGenPhase(AST& ast, std::shared_ptr<SymbolTable> symbolTable, const std::string& inputFile) {
     std::cout << "\n=========Phase 6: Code Generation=========" << std::endl;
     
     // Extract directory and filename
@@ -290,10 +306,13 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    std::string tableFile = "attribute_grammar_parsing_table.csv";
+    std::string tableFile; // Empty: the attribute grammar table compiled into the program
     std::string outputDir = ".";
     std::string inputFile;
     CompilerPhase targetPhase = CompilerPhase::CODEGEN; // Default to full compilation
+    bool recordDerivation = false;
+    bool pipelined = false;
+    bool recursiveDescent = false;
 
     // Parse command line arguments
     for (int i = 1; i < argc; ) {
@@ -317,6 +336,15 @@ int main(int argc, char* argv[]) {
                 std::cerr << "Error: --output requires a directory argument.\n";
                 return 1;
             }
+        } else if (arg == "-d" || arg == "--derivation") {
+            recordDerivation = true;
+            i++;
+        } else if (arg == "-P" || arg == "--pipeline") {
+            pipelined = true;
+            i++;
+        } else if (arg == "-r" || arg == "--recursive-descent") {
+            recursiveDescent = true;
+            i++;
         } else if (arg == "-p" || arg == "--phase") {
             if (i + 1 < argc) {
                 std::string phase = argv[i + 1];
@@ -348,6 +376,11 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
+    if (recursiveDescent && !tableFile.empty()) {
+        std::cerr << "Error: --recursive-descent only parses with the built-in table.\n";
+        return 1;
+    }
+
     // Ensure output directory exists
     if (!fs::exists(outputDir)) {
         std::cout << "Creating output directory: " << outputDir << std::endl;
@@ -368,9 +401,16 @@ int main(int argc, char* argv[]) {
         return 0;
     }
 
+    // Line index shared by the parser and the semantic phases for error snippets
+    std::shared_ptr<const LineIndex> lineIndex = scanner.getLineIndex();
+
+    // Identifiers are interned once, by the scanner, for all later phases, and
+    // the AST is allocated from the session's arena until the end of main()
+    CompilationSession session;
+    scanner.setInterner(&session.getInterner());
+
     // Phase 2: Syntax Analysis
-    // In main(), change to receive by value
-    AST ast = runParserPhase(inputFile, tableFile, scanner);
+    AST ast = runParserPhase(inputFile, tableFile, scanner, session, recordDerivation, pipelined, recursiveDescent);
     
     if (ast.getRoot()==nullptr) {
         return 1; // Error in parsing
@@ -384,6 +424,8 @@ int main(int argc, char* argv[]) {
 
     // Phase 3: Symbol Table Generation
     SymbolTableVisitor symbolTableVisitor;
+    symbolTableVisitor.setLineIndex(lineIndex);
+    symbolTableVisitor.setInterner(&session.getInterner());
     runSymbolTablePhase(ast, inputFile, symbolTableVisitor);
     
     // Stop if only symbol table generation was requested
@@ -393,7 +435,7 @@ int main(int argc, char* argv[]) {
     }
 
     // Phase 4: Semantic Analysis
-    bool semanticSuccess = runSemanticPhase(ast, symbolTableVisitor, inputFile);
+    bool semanticSuccess = runSemanticPhase(ast, symbolTableVisitor, inputFile, lineIndex);
     
     // Stop if only semantic analysis was requested
     if (targetPhase == CompilerPhase::SEMANTIC) {
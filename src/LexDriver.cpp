@@ -9,6 +9,7 @@
  * Usage:
  * - ./LexDriver <input_file>
  * - ./LexDriver <input_file> <output_filename>
+ * - ./LexDriver -j <threads> <input_file> [output_filename]
  * 
  * @author @TheBarzani
  * @date 2025-01-26
@@ -19,17 +20,24 @@
 #include <string>
 
 int main(int argc, char* argv[]) {
-    if (argc < 2) {
+    unsigned threads = 1;
+    int first = 1;
+    if (argc > 2 && std::string(argv[1]) == "-j") {
+        threads = static_cast<unsigned>(std::stoul(argv[2]));
+        first = 3;
+    }
+
+    if (argc - first < 1) {
         std::cout << "Usage: " << std::endl;
         std::cout << "- " << argv[0] << " <input_file>" << std::endl;
         std::cout << "- " << argv[0] << " <input_file>" << " <output_filename>"  << std::endl;
+        std::cout << "- " << argv[0] << " -j <threads> <input_file> [output_filename]" << std::endl;
         return 1;
     }
     
     try {
-        Scanner scanner(argv[1], argc < 3 ? "" : argv[2]);
-        scanner.processFile();
-        scanner.writeOutputsToFile();
+        Scanner scanner(argv[first], argc - first < 2 ? "" : argv[first + 1]);
+        scanner.processFile(threads);
         std::cout << "Lexical analysis completed successfully." << std::endl;
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << std::endl;
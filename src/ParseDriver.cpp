@@ -44,9 +44,12 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
+    // Load the table once; every parser below shares it.
+    std::shared_ptr<const ParsingTable> table = Parser::loadTable(tableFile);
+
     for (const auto& file : inputFiles) {
         std::cout << "Parsing file: " << file << " with table: " << tableFile << std::endl;
-        Parser parser(file, tableFile);
+        Parser parser(file, table, Scanner(file));
         parser.parse();
     }
 
@@ -1,24 +1,83 @@
 #include "Parser.h"
-#include <stack>
+#include "Parser/AttributeGrammarTable.h"
+#include "Parser/AttributeGrammarParser.h"
+#include <algorithm>
 #include <iostream>
 #include <fstream>
+#include <iterator>
 #include <sstream>
+#include <stdexcept>
 #include <vector>
 
-Parser::Parser(const std::string& inputFile, const std::string& parsingTable, const Scanner& scanner)
-    : table(ParsingTable(parsingTable)), scanner(scanner), currentDerivation("START") {
-    tokens = this->scanner.getTokens();
+namespace {
+
+/// Checks that the generated parser numbers its non-terminals as the compiled-in table does.
+constexpr bool generatedParserMatchesTable() {
+    for (const auto& [symbol, name] : AttributeGrammarParser::NON_TERMINAL_NAMES) {
+        if (symbol >= std::size(AttributeGrammarTable::symbolNames) ||
+            std::string_view(AttributeGrammarTable::symbolNames[symbol]) != name) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(generatedParserMatchesTable(),
+              "AttributeGrammarParser was generated from a different grammar than AttributeGrammarTable");
+
+} // namespace
+
+Parser::Parser(const std::string& inputFile, std::shared_ptr<const ParsingTable> table, const Scanner& scanner,
+               TokenSink* lexOutput)
+    : table(std::move(table)), scanner(scanner), tokenStream(this->scanner), lexOutput(lexOutput) {
+    parseStack.reserve(INITIAL_STACK_CAPACITY);
+    // Resolve the action symbols once so parse() dispatches on integers.
+    actions.assign(this->table->getSymbolCount(), SemanticAction::NONE);
+    for (size_t symbol = 0; symbol < actions.size(); ++symbol) {
+        if (this->table->isAction(static_cast<ParsingTable::Symbol>(symbol))) {
+            actions[symbol] = AST::resolveAction(this->table->getSymbolName(static_cast<ParsingTable::Symbol>(symbol)));
+        }
+    }
+    tokenStream.setTee(lexOutput);
     filename = inputFile.substr(0, inputFile.size() - 4);
 }
 
-Parser::Parser(const std::string& inputFile, const std::string& parsingTable)
-    : Parser(inputFile, parsingTable, Scanner(inputFile)) {
+Parser::Parser(const std::string& inputFile, const std::string& parsingTable, const Scanner& scanner,
+               TokenSink* lexOutput)
+    : Parser(inputFile, loadTable(parsingTable), scanner, lexOutput) {
+}
+
+Parser::Parser(const std::string& inputFile, const std::string& parsingTable, TokenSink* lexOutput)
+    : Parser(inputFile, parsingTable, Scanner(inputFile), lexOutput) {
+}
+
+std::shared_ptr<const ParsingTable> Parser::loadTable(const std::string& parsingTable) {
+    if (parsingTable.empty()) {
+        // Initialized once, thread-safely, on first use.
+        static const std::shared_ptr<const ParsingTable> builtIn =
+            std::make_shared<const ParsingTable>(AttributeGrammarTable::table);
+        return builtIn;
+    }
+    return std::make_shared<const ParsingTable>(parsingTable);
+}
+
+void Parser::reset(const std::string& inputFile, const Scanner& scanner, TokenSink* lexOutput) {
+    pipeline.reset();
+    this->scanner = scanner;
+    this->lexOutput = lexOutput;
+    tokenStream.reset();
+    tokenStream.setTee(lexOutput);
+    filename = inputFile.substr(0, inputFile.size() - 4);
+    parseStack.clear();
+    appliedProductions.clear();
+    syntaxErrors.clear();
+    lookahead = Token();
+    ast.clear();
 }
 
 Parser::~Parser() {
     // Clean memory
-    tokens.clear();
-    derivations.clear();
+    appliedProductions.clear();
     syntaxErrors.clear();
     
 }
@@ -31,15 +90,15 @@ bool Parser::writeOutputFiles(const std::string& outputPath) {
         ast.writeToFile(basePath + ".dot");
         
         // Write derivations to file
-        derivationOutput.open(basePath + ".outderivation");
-        if (!derivationOutput.is_open()) {
-            std::cerr << "Failed to open derivation output file" << std::endl;
-            success = false;
-        } else {
-            for (const auto& derivation : derivations) {
-                derivationOutput << derivation << std::endl;
+        if (recordDerivation) {
+            derivationOutput.open(basePath + ".outderivation");
+            if (!derivationOutput.is_open()) {
+                std::cerr << "Failed to open derivation output file" << std::endl;
+                success = false;
+            } else {
+                writeDerivation();
+                derivationOutput.close();
             }
-            derivationOutput.close();
         }
 
         // Write syntax errors to file
@@ -62,137 +121,151 @@ bool Parser::writeOutputFiles(const std::string& outputPath) {
 }
 
 bool Parser::parse() {
-    parseStack.push("$");
-    parseStack.push("START");
+    appliedProductions.clear();
+    if (pipelined) {
+        pipeline = std::make_unique<TokenPipeline>(scanner, lexOutput);
+    }
 
     lookahead = nextToken();
-    std::string currentLexeme;
+    bool accepted = recursiveDescent ? parseRecursiveDescent() : parseTableDriven();
+
+    // Scan whatever input is left so the lexical outputs cover the whole file.
+    if (pipeline) {
+        pipeline->drain();
+        pipeline.reset();
+    } else {
+        tokenStream.drain();
+    }
+    return accepted;
+}
+
+bool Parser::parseRecursiveDescent() {
+    AttributeGrammarParser generated(*this);
+    return generated.parse();
+}
+
+void Parser::setRecursiveDescent(bool enabled) {
+    if (enabled && table != loadTable("")) {
+        throw std::runtime_error("The recursive-descent parser is generated from the built-in grammar "
+                                 "and cannot parse with a table loaded from a file");
+    }
+    recursiveDescent = enabled;
+}
+
+bool Parser::parseTableDriven() {
+    const ParsingTable::Symbol end = table->getEndSymbol();
+    parseStack.clear();
+    parseStack.push_back(end);
+    parseStack.push_back(table->getStartSymbol());
+    stackHighWater = std::max(stackHighWater, parseStack.size());
+
+    std::string_view currentLexeme; // Slice of the source buffer, which outlives the parse
+    SymbolId currentSymbol = NO_SYMBOL;
+    LiteralValue currentLiteral;
     bool error = false;
 
-    while (parseStack.top() != "$") {
-        std::string x = parseStack.top();
-        // std::cout << "Current token: " << lookahead.type << ", Stack top: " << x << std::endl;
+    while (parseStack.back() != end) {
+        ParsingTable::Symbol x = parseStack.back();
+        ParsingTable::Symbol a = table->getTerminal(lookahead.kind);
+        // std::cout << "Current token: " << lookahead.type << ", Stack top: " << table->getSymbolName(x) << std::endl;
 
-        if (table.isTerminal(x)) {
-            if (x == lookahead.type) {
+        if (table->isTerminal(x)) {
+            if (x == a) {
                 // std::cout << "Matched terminal: " << x << std::endl;
-                parseStack.pop();
+                parseStack.pop_back();
                 currentLexeme = lookahead.lexeme;
+                currentSymbol = lookahead.symbol;
+                currentLiteral = lookahead.literal;
                 lookahead = nextToken();
+            } else if (error && lookahead.kind == TokenType::END_OF_FILE) {
+                // Recovery has reached the end of the input: drain the stack without reporting again.
+                parseStack.pop_back();
             } else {
-                std::cout << "Error: Expected " << x << " but got " << lookahead.type << std::endl;
-                syntaxErrors.push_back("Error: Expected " + x + " but got " + lookahead.type);
+                const std::string& expected = table->getSymbolName(x);
+                std::cout << "Error: Expected " << expected << " but got " << lookahead.type << std::endl;
+                syntaxErrors.push_back("Error: Expected " + expected + " but got " + std::string(lookahead.type));
                 skipErrors();
                 error = true;
             }
-        } else if (table.isNonTerminal(x)) {    
-            std::string production = table.getProduction(x, lookahead.type);
-            if (production != "error") {
-                // std::cout << "Using production: " << production << std::endl;
-                // Update the full derivation string:
-                std::string oldDerivation = currentDerivation;
-                // Replace the first occurrence of non-terminal x with the right-hand side production.
-                size_t pos = currentDerivation.find(x);
-                if (pos != std::string::npos) {
-                    std::istringstream iss(production);
-                    std::string temp;
-                    // Skip the first two tokens
-                    iss >> temp; // Skip the nonterminal
-                    iss >> temp; // Skip the arrow (->)
-
-                    std::string remainingProduction = "";
-                    // Remove any strings that start with '_' from the production
-                    while (iss >> temp) {
-                        if (temp.empty() || temp[0] != '_') {
-                            remainingProduction += " " + temp;
-                        }
-                    }
-                    // If "&epsilon" is encountered, treat it as an empty string.
-                    if (remainingProduction.find("&epsilon") != std::string::npos) {
-                        remainingProduction = "";
-                    }
-                    currentDerivation.replace(pos, x.length(), remainingProduction);
+        } else if (table->isNonTerminal(x)) {    
+            ParsingTable::ProductionId productionId = table->getProduction(x, a);
+            if (productionId != ParsingTable::NO_PRODUCTION) {
+                // std::cout << "Using production: " << table->getProductionText(productionId) << std::endl;
+                if (recordDerivation) {
+                    appliedProductions.push_back(productionId);
                 }
-                derivations.push_back("(" + oldDerivation + ", " + production + ")");
-                // ---------------------------------------------------------
-
-                parseStack.pop(); // Pop before pushing new symbols
-                inverseRHSMultiplePush(production);
+                parseStack.pop_back(); // Pop before pushing new symbols
+                inverseRHSMultiplePush(productionId);
+            } else if (error && lookahead.kind == TokenType::END_OF_FILE) {
+                parseStack.pop_back();
             } else {
-                std::cout << "No production found for " << x << " with lookahead " << lookahead.type << std::endl;
-                syntaxErrors.push_back("No production found for " + x + " with lookahead " + lookahead.type);
+                const std::string& name = table->getSymbolName(x);
+                std::cout << "No production found for " << name << " with lookahead " << lookahead.type << std::endl;
+                syntaxErrors.push_back("No production found for " + name + " with lookahead " + std::string(lookahead.type));
                 skipErrors();
                 error = true;
             }
         }
         else {
             // Perform action on the AST for the corresponding semantic attribute rule.
-            ast.performAction(x, currentLexeme, lookahead.line);
-            parseStack.pop();
+            try {
+                ast.performAction(actions[x], currentLexeme, lookahead.line, currentSymbol, currentLiteral);
+            } catch (const std::runtime_error&) {
+                // After a syntax error the semantic stack no longer matches the parse:
+                // actions whose nodes were skipped by the recovery are dropped.
+                if (!error) {
+                    throw;
+                }
+            }
+            parseStack.pop_back();
         }
     }
 
-    // Add the final derivation entry if we ended on '$'
-    if (parseStack.top() == "$") {
-        derivations.push_back("(" + currentDerivation + ", $)");
-    }
-
     // Always return true if the parse reaches "$", even if errors were encountered.
-    return (lookahead.type == "$" && !error);
+    return (lookahead.kind == TokenType::END_OF_FILE && !error);
 }
 
-Token Parser::nextToken() {
-    static auto it = tokens.begin();
-    while (it != tokens.end()) {
-        Token token = *it++;
-        if (token.type != "blockcmt" && token.type != "inlinecmt" &&
-            token.type.substr(0, 7) != "invalid") {
-            return token;
+void Parser::writeDerivation() {
+    // Replay the recorded productions: each one replaces the first occurrence
+    // of its non-terminal in the sentential form.
+    std::string sententialForm = table->getSymbolName(table->getStartSymbol());
+    for (ParsingTable::ProductionId production : appliedProductions) {
+        derivationOutput << "(" << sententialForm << ", " << table->getProductionText(production) << ")\n";
+        const std::string& name = table->getSymbolName(table->getProductionHead(production));
+        size_t pos = sententialForm.find(name);
+        if (pos != std::string::npos) {
+            sententialForm.replace(pos, name.length(), table->getDerivationText(production));
         }
     }
-    return {"$", "", scanner.getLineCount(), scanner.getLineCount()};
+    derivationOutput << "(" << sententialForm << ", $)\n";
 }
 
-void Parser::inverseRHSMultiplePush(const std::string& production) {
-    if (production.empty()) {
-        return;  // Handle empty production (epsilon)
-    }
-
-    std::istringstream iss(production);
-    std::vector<std::string> symbols;
-    std::string symbol;
-
-    // Skip the first two tokens (production format assumed to be: nonterminal → RHS)
-    int skippedCount = 0;
-    while (skippedCount < 2 && (iss >> symbol)) {
-        skippedCount++;
-    }
-
-    // Read the remaining symbols to be pushed
-    while (iss >> symbol) {
-        // Skip "&epsilon" symbols.
-        if (symbol == "&epsilon")
-            continue;
-        symbols.push_back(symbol);
+Token Parser::nextToken() {
+    Token token = pipeline ? pipeline->next() : tokenStream.next();
+    while (isCommentType(token.kind) || isErrorType(token.kind)) {
+        token = pipeline ? pipeline->next() : tokenStream.next();
     }
+    return token;
+}
 
-    // Push symbols in reverse order onto the parse stack.
-    for (auto it = symbols.rbegin(); it != symbols.rend(); ++it) {
-        parseStack.push(*it);
-    }
+void Parser::inverseRHSMultiplePush(ParsingTable::ProductionId production) {
+    // The table stores every right-hand side reversed, ready to push.
+    ParsingTable::ReversedRHS rhs = table->getReversedRHS(production);
+    parseStack.insert(parseStack.end(), rhs.begin(), rhs.end());
+    stackHighWater = std::max(stackHighWater, parseStack.size());
 }
 
-bool Parser::skipErrors() {
-    std::string A = parseStack.top();
-    
+void Parser::reportSyntaxError(ParsingTable::Symbol top) {
+    const std::string& A = table->getSymbolName(top);
+
     // Determine the expected tokens
     std::string expectedTokens = "";
-    if (table.isTerminal(A)) {
+    if (table->isTerminal(top)) {
         // If top of stack is terminal, we expected exactly that terminal
         expectedTokens = A;
-    } else if (table.isNonTerminal(A)) {
+    } else if (table->isNonTerminal(top)) {
         // If top of stack is non-terminal, we expected any token in FIRST(A)
-        std::vector<std::string> firstSet = table.getFirstSet(A);
+        std::vector<std::string> firstSet = table->getFirstSet(A);
         if (!firstSet.empty()) {
             expectedTokens = "one of [";
             for (size_t i = 0; i < firstSet.size(); i++) {
@@ -207,35 +280,44 @@ bool Parser::skipErrors() {
     
     // Build the error message with expected token information
     std::string errorMsg = "Syntax error at line " + std::to_string(lookahead.line) +
-                         ": Unexpected token '" + lookahead.type + "', expected " + 
+                         ": Unexpected token '" + std::string(lookahead.type) + "', expected " + 
                          (expectedTokens.empty() ? "different token" : expectedTokens);
     
-    std::cerr << errorMsg << std::endl;
+    SourcePosition position = scanner.locate(lookahead);
+    std::cerr << errorMsg << std::endl
+              << scanner.getLineIndex()->formatSnippet(position.line, position.column);
     syntaxErrors.push_back(errorMsg);
+}
+
+bool Parser::skipErrors() {
+    const ParsingTable::Symbol top = parseStack.back();
+    const std::string& A = table->getSymbolName(top);
+    // A token is acceptable if it is in FIRST(A), or, for an ε‑producing A, in FOLLOW(A).
+    auto acceptable = [&](const Token& token) {
+        ParsingTable::Symbol a = table->getTerminal(token.kind);
+        return table->isInFirst(top, a) || (table->hasEpsilon(top) && table->isInFollow(top, a));
+    };
+    reportSyntaxError(top);
 
     // If lookahead is "$" or in FOLLOW(A), recover by popping A.
-    if (lookahead.type == "$" || table.isInFollow(A, lookahead.type)) {
+    if (lookahead.kind == TokenType::END_OF_FILE || table->isInFollow(top, table->getTerminal(lookahead.kind))) {
         std::cout << "Panic mode recovery: Pop " << A << std::endl;
-        parseStack.pop();
+        parseStack.pop_back();
         return true;
     }
     
     // If the current token is already acceptable, do nothing.
-    if (table.isInFirst(A, lookahead.type) ||
-       (table.hasEpsilon(A) && table.isInFollow(A, lookahead.type))) {
+    if (acceptable(lookahead)) {
         return true;
     }
     
     // Otherwise, skip tokens until we find one in FIRST(A) (or, for an ε‑producing A, in FOLLOW(A)).
-    while (lookahead.type != "$" &&
-           !table.isInFirst(A, lookahead.type) &&
-           !(table.hasEpsilon(A) && table.isInFollow(A, lookahead.type))) {
+    while (lookahead.kind != TokenType::END_OF_FILE && !acceptable(lookahead)) {
         std::cout << "Skipping token: " << lookahead.type << std::endl;
-        syntaxErrors.push_back("Skipping token: " + lookahead.type);
+        syntaxErrors.push_back("Skipping token: " + std::string(lookahead.type));
         lookahead = nextToken();
         // Check immediately—if the new token is acceptable, break out.
-        if (table.isInFirst(A, lookahead.type) ||
-           (table.hasEpsilon(A) && table.isInFollow(A, lookahead.type))) {
+        if (acceptable(lookahead)) {
             std::cout << "Found acceptable token: " << lookahead.type << std::endl;
             break;
         }
@@ -246,3 +328,15 @@ bool Parser::skipErrors() {
 AST& Parser::getAST(){
     return ast;
 }
+
+std::shared_ptr<const LineIndex> Parser::getLineIndex() {
+    return scanner.getLineIndex();
+}
+
+void Parser::setInterner(StringInterner* interner) {
+    scanner.setInterner(interner);
+}
+
+void Parser::setArena(ASTArena* arena) {
+    ast.setArena(arena);
+}
@@ -5,7 +5,12 @@
  * received from a Scanner. It uses a ParsingTable to drive the parsing process and maintains a
  * parse stack to generate derivations. The class also handles error detection and recovery
  * mechanisms such as skipping errors during parsing. Detailed logging of derivations and syntax
- * errors is supported via output streams.
+ * errors is supported via output streams. Derivations are only recorded on request, as the
+ * sequence of applied productions; their text is rebuilt when the output files are written.
+ *
+ * All parse state lives in the instance, so parsers are reentrant: several can run at once on
+ * different threads, sharing one read-only ParsingTable, and one parser can be reset() onto a
+ * new input to parse many files without reloading the table.
  *
  * @author TheBarzani
  * @date 2025-02-17
@@ -17,41 +22,107 @@
 
 #include <string>
 #include <fstream>
-#include <stack>
+#include <memory>
+#include <vector>
 #include "ParsingTable.h"
 #include "Scanner/Scanner.h"
+#include "Scanner/TokenStream.h"
+#include "Scanner/TokenPipeline.h"
 #include "ASTGenerator/AST.h"
 
 class Parser {  
+    friend class RecursiveDescentParser; // The generated parser works on this parser's state.
+
     private:
-        ParsingTable table;                 // Parsing table used to guide the parsing process.
+        std::shared_ptr<const ParsingTable> table; // Parsing table guiding the parse; read-only and shareable.
         Scanner scanner;                    // Scanner object to tokenize the input file.
-        std::vector<Token> tokens;          // Vector holding the current list of tokens.
+        TokenStream tokenStream;            // Lookahead window the parser pulls tokens from.
+        TokenSink* lexOutput = nullptr;     // Optional sink for every scanned token.
+        bool pipelined = false;             // Whether to scan on a separate thread while parsing.
+        bool recursiveDescent = false;      // Whether to parse with the generated recursive-descent parser.
+        std::unique_ptr<TokenPipeline> pipeline; // Producer thread and token queue of a pipelined parse.
         std::ofstream derivationOutput;     // Output stream for logging derivations.
         std::ofstream errorOutput;          // Output stream for logging syntax errors.
-        std::stack<std::string> parseStack; // Stack used for holding parsing symbols.
+        std::vector<ParsingTable::Symbol> parseStack; // Stack of grammar symbol IDs, top at the back.
+        size_t stackHighWater = 0;          // Deepest the parse stack has been.
         Token lookahead;                    // The current lookahead token.
         std::string filename;               // Name of the file being parsed.
-        std::vector<std::string> derivations;    // List of derivation strings produced during parsing.
+        bool recordDerivation = false;      // Whether to record the applied productions.
+        std::vector<ParsingTable::ProductionId> appliedProductions; // Productions applied, in order, if recorded.
         std::vector<std::string> syntaxErrors;   // List of detected syntax errors.
-        std::string currentDerivation;      // Current derivation in progress.
         AST ast;                            // Abstract syntax tree (AST) object.
+        std::vector<SemanticAction> actions; // Semantic action of each grammar symbol, NONE for non-actions.
+
+        static constexpr size_t INITIAL_STACK_CAPACITY = 256; // Parse stack slots reserved up front.
+
+        /**
+         * @brief Parses with the parse stack, driven by the parsing table.
+         * @return true if the input was accepted without syntax errors.
+         */
+        bool parseTableDriven();
+
+        /**
+         * @brief Parses with the recursive-descent parser generated from the built-in grammar.
+         * @return true if the input was accepted; parsing stops at the first syntax error.
+         */
+        bool parseRecursiveDescent();
+
+        /**
+         * @brief Reports a syntax error at the lookahead, listing the tokens the symbol expected.
+         * @param top The grammar symbol that could not be matched or expanded.
+         */
+        void reportSyntaxError(ParsingTable::Symbol top);
 
     public:
     /**
      * @brief Initializes the Parser with the given parsing table and input file.
-     * @param parsingTable Path to the file containing the parsing table.
+     * @param parsingTable Path to the CSV file containing the parsing table, or an empty
+     *                     string for the attribute grammar table compiled into the program.
      * @param inputFile Path to the source code file to be parsed.
      * @param scanner Scanner object for tokenizing the input.
+     * @param lexOutput Optional sink that receives every scanned token, e.g. a
+     *                  TokenWriter producing the scanner output files.
      */
-    Parser(const std::string& parsingTable, const std::string& inputFile, const Scanner& scanner);
+    Parser(const std::string& parsingTable, const std::string& inputFile, const Scanner& scanner,
+           TokenSink* lexOutput = nullptr);
     
     /**
      * @brief Initializes the Parser with the given parsing table and input file.
      * @param inputFile Path to the source code file to be parsed.
-     * @param parsingTable Path to the file containing the parsing table.
+     * @param parsingTable Path to the CSV file containing the parsing table, or an empty
+     *                     string for the attribute grammar table compiled into the program.
+     * @param lexOutput Optional sink that receives every scanned token.
+     */
+    Parser(const std::string& inputFile, const std::string& parsingTable, TokenSink* lexOutput = nullptr);
+
+    /**
+     * @brief Initializes the Parser with an already loaded parsing table.
+     * @param inputFile Path to the source code file, used to name the output files.
+     * @param table The parsing table; it is only read, so one table can be shared by many parsers.
+     * @param scanner Scanner object for tokenizing the input.
+     * @param lexOutput Optional sink that receives every scanned token.
      */
-    Parser(const std::string& inputFile, const std::string& parsingTable);
+    Parser(const std::string& inputFile, std::shared_ptr<const ParsingTable> table, const Scanner& scanner,
+           TokenSink* lexOutput = nullptr);
+
+    /**
+     * @brief Loads a parsing table to share between parsers.
+     * @param parsingTable Path to the CSV file containing the parsing table, or an empty
+     *                     string for the attribute grammar table compiled into the program.
+     * @return The table. The built-in table is created once and shared by every caller.
+     */
+    static std::shared_ptr<const ParsingTable> loadTable(const std::string& parsingTable);
+
+    /**
+     * @brief Points the parser at a new input, discarding the state of the previous parse.
+     * @param inputFile Path to the source code file, used to name the output files.
+     * @param scanner Scanner object for tokenizing the new input.
+     * @param lexOutput Optional sink that receives every scanned token.
+     *
+     * The table, the reserved parse stack and the derivation setting are kept,
+     * so a single parser can work through many files.
+     */
+    void reset(const std::string& inputFile, const Scanner& scanner, TokenSink* lexOutput = nullptr);
 
     /**
      * @brief Cleans up any resources used by the Parser.
@@ -80,32 +151,95 @@ class Parser {
     
     /**
      * @brief Pushes the right-hand side production symbols onto the parse stack in reverse order.
-     * @param production The production rule whose symbols will be pushed onto the stack.
+     * @param production The ID of the production whose symbols will be pushed onto the stack.
      * 
      * Since the parse stack processes elements from top to bottom, this method ensures
-     * that symbols are pushed in the correct order for top-down parsing.
+     * that symbols are pushed in the correct order for top-down parsing. The table
+     * stores every right-hand side pre-split and reversed, so this is a plain copy.
      */
-    void inverseRHSMultiplePush(const std::string& production);
+    void inverseRHSMultiplePush(ParsingTable::ProductionId production);
     
+    /**
+     * @brief Writes the recorded derivation to the derivation output stream, one sentential form per line.
+     */
+    void writeDerivation();
+
     /**
      * @brief Retrieves the next token from the input.
      * @return The next token from the input stream.
      * 
-     * This method advances the scanner and returns the next meaningful token
-     * from the input source code.
+     * This method pulls from the token stream and returns the next meaningful
+     * token from the input source code, skipping comments and lexical errors.
      */
     Token nextToken();
 
+    /**
+     * @brief Enables or disables scanning on a separate thread while parsing.
+     * @param enabled Whether parse() runs the scanner on a producer thread that hands
+     *                token batches to the parser; off by default. The output is the same.
+     */
+    void setPipelined(bool enabled) { pipelined = enabled; }
+
+    /**
+     * @brief Selects the recursive-descent parser generated from the built-in grammar.
+     * @param enabled Whether parse() calls the generated parser, one function per non-terminal,
+     *                instead of interpreting the parsing table; off by default. It builds the
+     *                same AST and derivation, but stops at the first syntax error.
+     * @throws std::runtime_error if enabled while parsing with a table loaded from a file.
+     */
+    void setRecursiveDescent(bool enabled);
+
+    /**
+     * @brief Enables or disables recording the derivation for the .outderivation file.
+     * @param enabled Whether parse() records the productions it applies; off by default.
+     */
+    void setRecordDerivation(bool enabled) { recordDerivation = enabled; }
+
+    /**
+     * @brief Returns the deepest the parse stack has grown.
+     * @return The maximum number of symbols on the stack over every parse by this parser.
+     *
+     * The stack is reserved once and reused, so parsing does not allocate
+     * until a parse grows it beyond this depth.
+     */
+    size_t getStackHighWater() const { return stackHighWater; }
+
     /**
      * @brief Returns the Abstract Syntax Tree.
      * @return The Abstract Syntax Tree.
      */
     AST& getAST();
 
+    /**
+     * @brief Returns the line index of the parsed source, for error snippets in later phases.
+     * @return The shared line index.
+     */
+    std::shared_ptr<const LineIndex> getLineIndex();
+
+    /**
+     * @brief Interns the identifiers of the AST into the given interner.
+     * @param interner The session's interner; must be set before parse().
+     */
+    void setInterner(StringInterner* interner);
+
+    /**
+     * @brief Allocates the nodes of the AST from the given arena.
+     *
+     * The nodes then outlive the parser and are freed with the arena. By
+     * default the AST has an arena of its own, freed by reset() and with the parser.
+     *
+     * @param arena The session's arena; must be set before parse().
+     */
+    void setArena(ASTArena* arena);
+
      /**
      * @brief Writes all parser output files to the specified directory
      * @param outputPath The directory path where files should be written
      * @return true if files were written successfully, false otherwise
+     *
+     * The .outderivation file is only written if the derivation was recorded.
+     * Each sentential form is rebuilt from the recorded productions as it is
+     * written, so the derivation text is never held in memory.
      */
     bool writeOutputFiles(const std::string& outputPath = "");
 };
@@ -0,0 +1,242 @@
+/**
+ * @file ParserGen.cpp
+ * @brief Build-time tool that generates a recursive-descent parser from a grammar or parsing table CSV file.
+ *
+ * Every non-terminal becomes a function that switches on the lookahead token
+ * kind. The cases come straight from the LL(1) table row of the non-terminal,
+ * so the generated parser chooses exactly the productions the table-driven
+ * parser would. A production's symbols are matched, called or performed in
+ * order. A non-terminal at the end of a production is a tail call, and a
+ * non-terminal that ends one of its own productions loops instead of
+ * recursing, so long lists do not grow the call stack.
+ *
+ * Usage: parsergen <table.csv | grammar.grm> <output.h> <class name>
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#include "Parser/ParsingTable.h"
+#include "ASTGenerator/SemanticAction.h"
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Symbol = ParsingTable::Symbol;
+using ProductionId = ParsingTable::ProductionId;
+
+/**
+ * @brief Converts a lower camel case name to upper snake case, e.g. "createRoot" to "CREATE_ROOT".
+ */
+std::string upperSnakeCase(const std::string& name) {
+    std::string result;
+    for (size_t i = 0; i < name.size(); ++i) {
+        if (i > 0 && std::isupper(static_cast<unsigned char>(name[i])) &&
+            std::islower(static_cast<unsigned char>(name[i - 1]))) {
+            result += '_';
+        }
+        result += static_cast<char>(std::toupper(static_cast<unsigned char>(name[i])));
+    }
+    return result;
+}
+
+/**
+ * @brief Retrieves the TokenType enumerator of a terminal, checking that it is the only kind the terminal has.
+ */
+std::string tokenKindName(const ParsingTable& table, Symbol terminal) {
+    const std::string& name = table.getSymbolName(terminal);
+    TokenType kind;
+    if (!tokenTypeFromName(name, kind) || table.getTerminal(kind) != terminal) {
+        throw std::runtime_error("Terminal " + name + " is not a token type");
+    }
+    for (size_t other = 0; other < static_cast<size_t>(TokenType::COUNT); ++other) {
+        if (static_cast<TokenType>(other) != kind && table.getTerminal(static_cast<TokenType>(other)) == terminal) {
+            throw std::runtime_error("Terminal " + name + " stands for more than one token type");
+        }
+    }
+    return "TokenType::" + (kind == TokenType::END_OF_FILE ? std::string("END_OF_FILE") : upperSnakeCase(name));
+}
+
+/**
+ * @brief Retrieves the name of the function that parses a non-terminal.
+ */
+std::string functionName(const ParsingTable& table, Symbol nonTerminal) {
+    return "parse" + table.getSymbolName(nonTerminal);
+}
+
+/**
+ * @brief Writes the statements of one production, in order.
+ * @return true if the production ends by looping back into its own non-terminal.
+ */
+bool writeProduction(std::ostream& out, const ParsingTable& table, Symbol nonTerminal, ProductionId production) {
+    ParsingTable::ReversedRHS reversed = table.getReversedRHS(production);
+    std::vector<Symbol> body(reversed.begin(), reversed.end());
+    std::reverse(body.begin(), body.end());
+
+    out << "        derive(" << production << ");\n";
+    for (size_t i = 0; i < body.size(); ++i) {
+        Symbol symbol = body[i];
+        bool last = i + 1 == body.size();
+        if (table.isTerminal(symbol)) {
+            out << "        if (!match(" << tokenKindName(table, symbol) << ")) return false;\n";
+        } else if (table.isNonTerminal(symbol)) {
+            if (last && symbol == nonTerminal) {
+                out << "        continue;\n";
+                return true;
+            } else if (last) {
+                out << "        return " << functionName(table, symbol) << "();\n";
+                return false;
+            }
+            out << "        if (!" << functionName(table, symbol) << "()) return false;\n";
+        } else {
+            const std::string& action = table.getSymbolName(symbol);
+            if (resolveSemanticAction(action) == SemanticAction::NONE) {
+                out << "        // " << action << " is not implemented by the AST\n";
+            } else {
+                out << "        act(SemanticAction::" << upperSnakeCase(action.substr(1)) << ");\n";
+            }
+        }
+    }
+    out << "        return true;\n";
+    return false;
+}
+
+/**
+ * @brief Writes the function that parses one non-terminal.
+ */
+void writeNonTerminal(std::ostream& out, const ParsingTable& table, const std::string& className, Symbol nonTerminal) {
+    // Group the lookahead terminals by the production they select, in production order.
+    std::map<ProductionId, std::vector<Symbol>> cases;
+    for (size_t t = 0; t < table.getTerminals().size(); ++t) {
+        ProductionId production = table.getProduction(nonTerminal, static_cast<Symbol>(t));
+        if (production != ParsingTable::NO_PRODUCTION) {
+            cases[production].push_back(static_cast<Symbol>(t));
+        }
+    }
+
+    std::string body;
+    bool loops = false;
+    for (const auto& [production, terminals] : cases) {
+        std::ostringstream code;
+        code << "    // " << table.getProductionText(production) << "\n";
+        for (Symbol terminal : terminals) {
+            code << "    case " << tokenKindName(table, terminal) << ":\n";
+        }
+        code << "    {\n";
+        loops |= writeProduction(code, table, nonTerminal, production);
+        code << "    }\n";
+        body += code.str();
+    }
+
+    out << "inline bool " << className << "::" << functionName(table, nonTerminal) << "() {\n";
+    std::string indent = loops ? "    " : "";
+    if (loops) {
+        out << "    for (;;) {\n";
+    }
+    out << indent << "    switch (lookaheadKind()) {\n";
+    std::istringstream lines(body);
+    for (std::string line; std::getline(lines, line);) {
+        out << indent << line << "\n";
+    }
+    out << indent << "    default:\n"
+        << indent << "        return noProduction(" << table.getSymbolName(nonTerminal) << ");\n"
+        << indent << "    }\n";
+    if (loops) {
+        out << "    }\n";
+    }
+    out << "}\n\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc != 4) {
+        std::cerr << "Usage: " << argv[0] << " <table.csv | grammar.grm> <output.h> <class name>\n";
+        return 1;
+    }
+    const std::string inputFile = argv[1];
+    const std::string outputFile = argv[2];
+    const std::string className = argv[3];
+
+    try {
+        ParsingTable table(inputFile);
+        if (!table.getConflicts().empty()) {
+            std::cerr << "Error: " << table.getConflicts().size() << " LL(1) conflicts in " << inputFile << std::endl;
+            return 1;
+        }
+        std::vector<Symbol> nonTerminals;
+        for (const std::string& name : table.getNonTerminals()) {
+            nonTerminals.push_back(table.getSymbol(name));
+        }
+
+        std::ostringstream functions;
+        for (Symbol nonTerminal : nonTerminals) {
+            writeNonTerminal(functions, table, className, nonTerminal);
+        }
+
+        std::ofstream out(outputFile);
+        if (!out.is_open()) {
+            std::cerr << "Failed to open output file: " << outputFile << std::endl;
+            return 1;
+        }
+        std::string guard = className;
+        std::transform(guard.begin(), guard.end(), guard.begin(), [](unsigned char c) { return std::toupper(c); });
+        guard += "_H";
+
+        out << "/**\n"
+            << " * @file " << std::filesystem::path(outputFile).filename().string() << "\n"
+            << " * @brief Recursive-descent parser generated from " << std::filesystem::path(inputFile).filename().string() << ".\n"
+            << " *\n"
+            << " * Generated by parsergen at build time. Do not edit.\n"
+            << " */\n\n"
+            << "#ifndef " << guard << "\n"
+            << "#define " << guard << "\n\n"
+            << "#include \"Parser/RecursiveDescentParser.h\"\n"
+            << "#include <string_view>\n"
+            << "#include <utility>\n\n"
+            << "class " << className << " : public RecursiveDescentParser {\n"
+            << "public:\n"
+            << "    using RecursiveDescentParser::RecursiveDescentParser;\n\n"
+            << "    /// Non-terminals, numbered as in the parsing table the parser was generated from.\n"
+            << "    enum NonTerminal : ParsingTable::Symbol {\n";
+        for (Symbol nonTerminal : nonTerminals) {
+            out << "        " << table.getSymbolName(nonTerminal) << " = " << nonTerminal << ",\n";
+        }
+        out << "    };\n\n"
+            << "    /// Name of each non-terminal, to check the numbering against the table the parser runs with.\n"
+            << "    static constexpr std::pair<NonTerminal, std::string_view> NON_TERMINAL_NAMES[] = {\n";
+        for (Symbol nonTerminal : nonTerminals) {
+            const std::string& name = table.getSymbolName(nonTerminal);
+            out << "        {" << name << ", \"" << name << "\"},\n";
+        }
+        out << "    };\n\n"
+            << "    /**\n"
+            << "     * @brief Parses the whole input from the start symbol.\n"
+            << "     * @return true if the input was accepted; parsing stops at the first syntax error.\n"
+            << "     */\n"
+            << "    bool parse() {\n"
+            << "        return " << functionName(table, table.getStartSymbol())
+            << "() && lookaheadKind() == TokenType::END_OF_FILE;\n"
+            << "    }\n\n"
+            << "private:\n";
+        for (Symbol nonTerminal : nonTerminals) {
+            out << "    bool " << functionName(table, nonTerminal) << "();\n";
+        }
+        out << "};\n\n"
+            << functions.str()
+            << "#endif // " << guard << "\n";
+        return out ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
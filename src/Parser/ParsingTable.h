@@ -6,6 +6,30 @@
  * for loading a parsing table from a CSV file, computing FIRST and FOLLOW sets, and providing
  * helper methods to query grammar productions.
  *
+ * Grammar symbols are numbered when the table is loaded: terminals first, in
+ * column order, then non-terminals, in row order, then the semantic actions
+ * found in the productions. Each kind is a contiguous range of IDs, so
+ * classifying a symbol is a comparison. Every production is split
+ * once, into its right-hand side symbols stored in push order. FIRST and FOLLOW
+ * sets are bitsets over the terminals. The parser works on these IDs only; the
+ * name-based queries remain for error reporting and tools.
+ *
+ * Most cells of the [non-terminal][terminal] table are empty, so the rows are
+ * stored by row displacement: each row is shifted to an offset where its
+ * non-empty cells land on free slots of one shared array, and every slot
+ * records the row that owns it. A lookup reads the row offset and one slot;
+ * a slot owned by another row is an empty (error) cell.
+ *
+ * A table can also be built from ParsingTable::Compiled data, which tablegen
+ * generates from the CSV file at build time in exactly this layout, so the
+ * drivers start without reading or analysing the CSV file.
+ *
+ * A table can also be computed from a .grm grammar file instead of a CSV file:
+ * the FIRST and FOLLOW sets are computed from the productions, then each
+ * production is entered in the cells of the terminals that select it. Cells
+ * claimed by more than one production are LL(1) conflicts; the first
+ * production in grammar order keeps the cell and the conflict is recorded.
+ *
  * @author TheBarzani
  * @date 2025-02-17
  */
@@ -18,25 +42,133 @@
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 #include <iostream>
 #include <algorithm>
-#include <map>
-#include <set>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include "Scanner/Token.h"
 
 /**
  * @brief Represents a parsing table used for syntax analysis.
  */
 class ParsingTable {
+public:
+    /// ID of a grammar symbol (terminal, non-terminal or semantic action).
+    using Symbol = uint16_t;
+
+    /// ID of a production.
+    using ProductionId = uint16_t;
+
+    /// Marks a symbol name that is not part of the grammar.
+    static constexpr Symbol NO_SYMBOL = UINT16_MAX;
+
+    /// Marks an empty table cell.
+    static constexpr ProductionId NO_PRODUCTION = UINT16_MAX;
+
+    /**
+     * @brief One slot of the row-displacement table.
+     */
+    struct PackedCell {
+        Symbol row;              ///< Row (non-terminal ID - terminal count) owning the slot, or NO_SYMBOL
+        ProductionId production; ///< Production in the owner's cell
+    };
+
+    /**
+     * @brief A parsing table as constant arrays, generated by tablegen.
+     *
+     * The arrays hold exactly what a ParsingTable stores, in the same order.
+     */
+    struct Compiled {
+        size_t terminalCount;               ///< Number of terminals
+        size_t nonTerminalCount;            ///< Number of non-terminals
+        size_t symbolCount;                 ///< Number of symbols, actions included
+        const char* const* symbolNames;     ///< Symbol names by ID
+        size_t productionCount;             ///< Number of productions
+        const char* const* productions;     ///< Production text by ID
+        const Symbol* productionHeads;      ///< Left-hand side of each production
+        const uint32_t* rhsStarts;          ///< productionCount + 1 offsets into rhsSymbols
+        const Symbol* rhsSymbols;           ///< Reversed right-hand sides, back to back
+        const char* const* derivationTexts; ///< Derivation text by production ID
+        const uint32_t* rowOffsets;         ///< Offset of each non-terminal row in packedCells
+        size_t packedCellCount;             ///< Number of slots in packedCells
+        const PackedCell* packedCells;      ///< Row-displacement table
+        size_t setWords;                    ///< Words per FIRST or FOLLOW bitset
+        const uint64_t* firstSets;          ///< nonTerminalCount x setWords FIRST bits
+        const uint64_t* followSets;         ///< nonTerminalCount x setWords FOLLOW bits
+        const uint8_t* nullable;            ///< Whether each FIRST set contains &epsilon
+    };
+
 private:
     /// List of terminal symbols.
     std::vector<std::string> terminals;
     
     /// List of non-terminal symbols.
     std::vector<std::string> nonTerminals;
-    
-    /// Main parsing table mapping non-terminal -> terminal -> production string.
-    std::unordered_map<std::string, 
-                      std::unordered_map<std::string, std::string>> table;
+
+    /// Symbol names by ID: terminals, then non-terminals, then actions.
+    std::vector<std::string> symbolNames;
+
+    /// Symbol IDs by name.
+    std::unordered_map<std::string, Symbol> symbolIds;
+
+    /// Production text by ID; equal productions share one ID.
+    std::vector<std::string> productions;
+
+    /// Left-hand side non-terminal of each production.
+    std::vector<Symbol> productionHeads;
+
+    /// Right-hand sides of all productions back to back, each reversed and without &epsilon.
+    std::vector<Symbol> rhsSymbols;
+
+    /// Start of the right-hand side of each production in rhsSymbols, plus the end of the last one.
+    std::vector<uint32_t> rhsStarts;
+
+    /// Text replacing the non-terminal in the derivation, by production ID.
+    std::vector<std::string> derivationTexts;
+
+    /// Offset of each non-terminal row in packedCells; the cell of terminal t is at rowOffsets[row] + t.
+    std::vector<uint32_t> rowOffsets;
+
+    /// Main parsing table: the non-empty cells of all rows, overlaid by row displacement.
+    /// Any row offset plus any terminal ID is a valid index.
+    std::vector<PackedCell> packedCells;
+
+    /// Terminal ID of every token kind, or NO_SYMBOL for kinds the grammar does not use.
+    std::array<Symbol, static_cast<size_t>(TokenType::COUNT)> terminalOfKind{};
+
+    Symbol startSymbol = NO_SYMBOL; ///< ID of START
+    Symbol endSymbol = NO_SYMBOL;   ///< ID of the end marker "$"
+
+    /// Words in each FIRST and FOLLOW bitset; bit t of a set stands for terminal t.
+    size_t setWords = 0;
+
+    /// FIRST set of each non-terminal, setWords words per non-terminal.
+    std::vector<uint64_t> firstBits;
+
+    /// FOLLOW set of each non-terminal, laid out like firstBits.
+    std::vector<uint64_t> followBits;
+
+    /// Whether the FIRST set of each non-terminal contains &epsilon.
+    std::vector<uint8_t> nullable;
+
+    /// LL(1) conflicts found while computing the table from a grammar.
+    std::vector<std::string> conflicts;
+
+    /**
+     * @brief Retrieves the ID of a symbol, numbering it if it is new.
+     *
+     * @param name The symbol name.
+     * @return The ID of the symbol.
+     */
+    Symbol addSymbol(const std::string& name) {
+        auto [it, added] = symbolIds.emplace(name, static_cast<Symbol>(symbolNames.size()));
+        if (added) {
+            symbolNames.push_back(name);
+        }
+        return it->second;
+    }
 
     /**
      * @brief Splits a CSV line into separate tokens.
@@ -72,165 +204,378 @@ private:
         return tokens;
     }
 
-    /// Map storing FIRST sets for non-terminals.
-    std::map<std::string, std::set<std::string>> firstSets;
-    /// Map storing FOLLOW sets for non-terminals.
-    std::map<std::string, std::set<std::string>> followSets;
+    /**
+     * @brief Merges one bitset row into another.
+     *
+     * @param bits firstBits or followBits.
+     * @param into Row index (non-terminal ID - terminal count) to merge into.
+     * @param from Row index to merge from.
+     * @return True if the row merged into changed.
+     */
+    bool mergeRow(std::vector<uint64_t>& bits, size_t into, size_t from) {
+        bool changed = false;
+        for (size_t w = 0; w < setWords; ++w) {
+            uint64_t merged = bits[into * setWords + w] | bits[from * setWords + w];
+            changed |= merged != bits[into * setWords + w];
+            bits[into * setWords + w] = merged;
+        }
+        return changed;
+    }
 
     /**
-     * @brief Computes the FIRST sets for all non-terminals.
+     * @brief Propagates bitsets along "row from flows into row into" edges until nothing changes.
+     *
+     * Only rows that changed are revisited: a row is queued when it changes,
+     * and popping it merges it into the rows that depend on it.
      *
-     * Iterates over productions until no more changes occur and updates the FIRST sets.
+     * @param bits firstBits or followBits.
+     * @param dependents For each row, the rows its set flows into.
      */
-    void computeFirstSets() {
-        // Initialize FIRST sets for each non-terminal.
-        for (const auto& nt : nonTerminals) {
-            firstSets[nt] = std::set<std::string>();
+    void propagate(std::vector<uint64_t>& bits, const std::vector<std::vector<size_t>>& dependents) {
+        std::vector<size_t> worklist;
+        std::vector<uint8_t> queued(nonTerminals.size(), 1);
+        for (size_t row = nonTerminals.size(); row-- > 0;) {
+            worklist.push_back(row);
         }
-    
-        bool changed;
-        do {
-            changed = false;
-            for (const auto& nt : nonTerminals) {
-                for (const auto& term : terminals) {
-                    std::string prod = getProduction(nt, term);
-                    if (prod != "error") {
-                        std::istringstream iss(prod);
-                        std::string firstSymbol;
-                        iss >> firstSymbol;
-                        
-                        if (isTerminal(firstSymbol)) {
-                            // If production starts with terminal, add it to FIRST set.
-                            changed |= addToFirst(nt, firstSymbol);
-                        } else if (isNonTerminal(firstSymbol)) {
-                            // If production starts with non-terminal, add its FIRST set.
-                            auto firstOfSymbol = getFirstOfSymbol(firstSymbol);
-                            for (const auto& symbol : firstOfSymbol) {
-                                changed |= addToFirst(nt, symbol);
-                            }
-                        }
-                    }
+        while (!worklist.empty()) {
+            size_t row = worklist.back();
+            worklist.pop_back();
+            queued[row] = 0;
+            for (size_t dependent : dependents[row]) {
+                if (mergeRow(bits, dependent, row) && !queued[dependent]) {
+                    queued[dependent] = 1;
+                    worklist.push_back(dependent);
                 }
             }
-        } while (changed);
+        }
     }
-    
+
     /**
-     * @brief Computes the FOLLOW sets for all non-terminals.
+     * @brief Computes the nullable flags and the FIRST and FOLLOW sets of all non-terminals.
      *
-     * Initializes the FOLLOW sets and iteratively updates them until stable.
+     * Works on the pre-split productions. Semantic actions derive nothing, so
+     * they are skipped. Nullable non-terminals are found by counting down the
+     * symbols of each production that are not yet known to be nullable; FIRST
+     * and FOLLOW are seeded from each production once, then propagated along
+     * the dependencies between non-terminals with a worklist.
      */
-    void computeFollowSets() {
-        // Initialize FOLLOW sets for each non-terminal.
-        for (const auto& nt : nonTerminals) {
-            followSets[nt] = std::set<std::string>();
+    void computeSets() {
+        const size_t terminalCount = terminals.size();
+        const size_t nonTerminalCount = nonTerminals.size();
+        setWords = (terminalCount + 63) / 64;
+        firstBits.assign(nonTerminalCount * setWords, 0);
+        followBits.assign(nonTerminalCount * setWords, 0);
+        nullable.assign(nonTerminalCount, 0);
+
+        // Right-hand sides in source order, actions dropped.
+        std::vector<std::vector<Symbol>> bodies(productions.size());
+        for (size_t p = 0; p < productions.size(); ++p) {
+            ReversedRHS rhs = getReversedRHS(static_cast<ProductionId>(p));
+            for (const Symbol* it = rhs.end(); it != rhs.begin();) {
+                --it;
+                if (!isAction(*it)) {
+                    bodies[p].push_back(*it);
+                }
+            }
         }
-        
-        // Add end marker to the START symbol's FOLLOW set.
-        followSets["START"].insert("$");
-    
-        bool changed;
-        do {
-            changed = false;
-            for (const auto& nt : nonTerminals) {
-                for (const auto& term : terminals) {
-                    std::string prod = getProduction(nt, term);
-                    if (prod != "error") {
-                        std::istringstream iss(prod);
-                        std::vector<std::string> symbols;
-                        std::string symbol;
-                        while (iss >> symbol) {
-                            symbols.push_back(symbol);
-                        }
-    
-                        // Process each symbol in the production.
-                        for (size_t i = 0; i < symbols.size(); i++) {
-                            if (isNonTerminal(symbols[i])) {
-                                // If not the last symbol, add FIRST set of the next symbol.
-                                if (i < symbols.size() - 1) {
-                                    auto firstOfNext = getFirstOfSymbol(symbols[i + 1]);
-                                    for (const auto& f : firstOfNext) {
-                                        changed |= addToFollow(symbols[i], f);
-                                    }
-                                }
-                                // If last symbol, or FIRST of next contains ε, add FOLLOW of current non-terminal.
-                                if (i == symbols.size() - 1) {
-                                    auto followOfNT = followSets[nt];
-                                    for (const auto& f : followOfNT) {
-                                        changed |= addToFollow(symbols[i], f);
-                                    }
-                                }
-                            }
-                        }
+
+        // Nullable: a production is nullable once all of its symbols are.
+        std::vector<size_t> pending(productions.size());
+        std::vector<std::vector<size_t>> occurrences(nonTerminalCount);
+        std::vector<size_t> worklist;
+        for (size_t p = 0; p < productions.size(); ++p) {
+            bool hasTerminal = false;
+            for (Symbol symbol : bodies[p]) {
+                if (isTerminal(symbol)) {
+                    hasTerminal = true;
+                } else {
+                    occurrences[symbol - terminalCount].push_back(p);
+                }
+            }
+            pending[p] = hasTerminal ? SIZE_MAX : bodies[p].size();
+            size_t head = productionHeads[p] - terminalCount;
+            if (pending[p] == 0 && !nullable[head]) {
+                nullable[head] = 1;
+                worklist.push_back(head);
+            }
+        }
+        while (!worklist.empty()) {
+            size_t nt = worklist.back();
+            worklist.pop_back();
+            for (size_t p : occurrences[nt]) {
+                size_t head = productionHeads[p] - terminalCount;
+                if (pending[p] != SIZE_MAX && --pending[p] == 0 && !nullable[head]) {
+                    nullable[head] = 1;
+                    worklist.push_back(head);
+                }
+            }
+        }
+
+        // FIRST: terminals that can start a production, plus the FIRST sets
+        // of the non-terminals that can start it.
+        std::vector<std::vector<size_t>> firstDependents(nonTerminalCount);
+        for (size_t p = 0; p < productions.size(); ++p) {
+            size_t head = productionHeads[p] - terminalCount;
+            for (Symbol symbol : bodies[p]) {
+                if (isTerminal(symbol)) {
+                    firstBits[head * setWords + symbol / 64] |= uint64_t{1} << (symbol % 64);
+                    break;
+                }
+                firstDependents[symbol - terminalCount].push_back(head);
+                if (!nullable[symbol - terminalCount]) break;
+            }
+        }
+        propagate(firstBits, firstDependents);
+
+        // FOLLOW: what can come after each non-terminal in a production,
+        // plus the FOLLOW set of the head when nothing but nullable symbols does.
+        std::vector<std::vector<size_t>> followDependents(nonTerminalCount);
+        followBits[(startSymbol - terminalCount) * setWords + endSymbol / 64] |= uint64_t{1} << (endSymbol % 64);
+        for (size_t p = 0; p < productions.size(); ++p) {
+            size_t head = productionHeads[p] - terminalCount;
+            const std::vector<Symbol>& body = bodies[p];
+            for (size_t i = 0; i < body.size(); ++i) {
+                if (isTerminal(body[i])) continue;
+                size_t nt = body[i] - terminalCount;
+                size_t j = i + 1;
+                for (; j < body.size(); ++j) {
+                    if (isTerminal(body[j])) {
+                        followBits[nt * setWords + body[j] / 64] |= uint64_t{1} << (body[j] % 64);
+                        break;
+                    }
+                    for (size_t w = 0; w < setWords; ++w) {
+                        followBits[nt * setWords + w] |= firstBits[(body[j] - terminalCount) * setWords + w];
                     }
+                    if (!nullable[body[j] - terminalCount]) break;
+                }
+                if (j == body.size() && head != nt) {
+                    followDependents[head].push_back(nt);
                 }
             }
-        } while (changed);
+        }
+        propagate(followBits, followDependents);
     }
-    
+
     /**
-     * @brief Retrieves the FIRST set for a given symbol.
+     * @brief Tests the bit of a terminal in the set of a non-terminal.
      *
-     * If the symbol is a terminal, returns a set containing just that terminal.
-     * Otherwise, returns the FIRST set computed for the non-terminal.
+     * @param bits firstBits or followBits.
+     * @param nonTerminal A non-terminal ID.
+     * @param terminal A terminal ID.
+     * @return True if the terminal is in the set.
+     */
+    bool testBit(const std::vector<uint64_t>& bits, Symbol nonTerminal, Symbol terminal) const {
+        size_t word = (nonTerminal - terminals.size()) * setWords + terminal / 64;
+        return (bits[word] >> (terminal % 64)) & 1;
+    }
+
+    /**
+     * @brief Maps token kinds to terminals and finds the START and "$" symbols.
+     */
+    void indexTerminals() {
+        terminalOfKind.fill(NO_SYMBOL);
+        for (size_t kind = 0; kind < terminalOfKind.size(); ++kind) {
+            Symbol symbol = getSymbol(std::string(tokenTypeName(static_cast<TokenType>(kind))));
+            if (isTerminal(symbol)) {
+                terminalOfKind[kind] = symbol;
+            }
+        }
+        startSymbol = getSymbol("START");
+        endSymbol = getSymbol("$");
+        if (!isNonTerminal(startSymbol)) startSymbol = NO_SYMBOL;
+        if (!isTerminal(endSymbol)) endSymbol = NO_SYMBOL;
+    }
+
+    /**
+     * @brief Stores a dense table by row displacement.
      *
-     * @param symbol The symbol whose FIRST set is required.
-     * @return A set of strings representing the FIRST set of the symbol.
+     * Rows are placed fullest first, each at the lowest offset where none of
+     * its non-empty cells collides with a slot already taken.
+     *
+     * @param dense Production IDs, one row of terminals.size() cells per non-terminal.
      */
-    std::set<std::string> getFirstOfSymbol(const std::string& symbol) {
-        if (isTerminal(symbol)) {
-            return {symbol};
+    void compressCells(const std::vector<ProductionId>& dense) {
+        const size_t terminalCount = terminals.size();
+        const size_t rowCount = nonTerminals.size();
+        std::vector<std::vector<Symbol>> columns(rowCount);
+        for (size_t row = 0; row < rowCount; ++row) {
+            for (size_t t = 0; t < terminalCount; ++t) {
+                if (dense[row * terminalCount + t] != NO_PRODUCTION) {
+                    columns[row].push_back(static_cast<Symbol>(t));
+                }
+            }
+        }
+        std::vector<size_t> order(rowCount);
+        for (size_t row = 0; row < rowCount; ++row) {
+            order[row] = row;
+        }
+        std::stable_sort(order.begin(), order.end(),
+                         [&](size_t a, size_t b) { return columns[a].size() > columns[b].size(); });
+
+        const PackedCell empty{NO_SYMBOL, NO_PRODUCTION};
+        rowOffsets.assign(rowCount, 0);
+        packedCells.clear();
+        size_t end = terminalCount; // Slots needed so every row can be indexed by every terminal
+        for (size_t row : order) {
+            if (columns[row].empty()) continue;
+            size_t offset = 0;
+            auto collides = [&](size_t at) {
+                for (Symbol t : columns[row]) {
+                    if (at + t < packedCells.size() && packedCells[at + t].row != NO_SYMBOL) return true;
+                }
+                return false;
+            };
+            while (collides(offset)) {
+                ++offset;
+            }
+            packedCells.resize(std::max(packedCells.size(), offset + columns[row].back() + 1), empty);
+            for (Symbol t : columns[row]) {
+                packedCells[offset + t] = {static_cast<Symbol>(row), dense[row * terminalCount + t]};
+            }
+            rowOffsets[row] = static_cast<uint32_t>(offset);
+            end = std::max(end, offset + terminalCount);
         }
-        return firstSets[symbol];
+        packedCells.resize(end, empty);
     }
-    
+
     /**
-     * @brief Adds a terminal into the FIRST set of a non-terminal.
+     * @brief Splits every production once into its reversed right-hand side and derivation text.
      *
-     * @param nonTerminal The non-terminal whose FIRST set is to be updated.
-     * @param terminal The terminal to add.
-     * @return True if the FIRST set was modified, false otherwise.
+     * Every right-hand side symbol that is not a terminal or a non-terminal is
+     * a semantic action, numbered here.
+     *
+     * @return False if there are too many symbols to number.
      */
-    bool addToFirst(const std::string& nonTerminal, const std::string& terminal) {
-        size_t originalSize = firstSets[nonTerminal].size();
-        firstSets[nonTerminal].insert(terminal);
-        return firstSets[nonTerminal].size() > originalSize;
+    bool splitProductions() {
+        rhsStarts.reserve(productions.size() + 1);
+        derivationTexts.reserve(productions.size());
+        for (const auto& production : productions) {
+            std::istringstream iss(production);
+            std::string symbol;
+            iss >> symbol >> symbol; // Skip the non-terminal and the arrow
+            rhsStarts.push_back(static_cast<uint32_t>(rhsSymbols.size()));
+            std::string derivation;
+            bool epsilon = false;
+            while (iss >> symbol) {
+                if (symbol == "&epsilon") {
+                    epsilon = true;
+                    continue;
+                }
+                rhsSymbols.push_back(addSymbol(symbol));
+                if (symbol[0] != '_') {
+                    derivation += " " + symbol;
+                }
+            }
+            std::reverse(rhsSymbols.begin() + rhsStarts.back(), rhsSymbols.end());
+            derivationTexts.push_back(epsilon ? "" : derivation);
+        }
+        rhsStarts.push_back(static_cast<uint32_t>(rhsSymbols.size()));
+        return symbolNames.size() <= NO_SYMBOL;
     }
-    
+
     /**
-     * @brief Adds a terminal into the FOLLOW set of a non-terminal.
+     * @brief Fills the table from the FIRST and FOLLOW sets, recording LL(1) conflicts.
      *
-     * @param nonTerminal The non-terminal whose FOLLOW set is to be updated.
-     * @param terminal The terminal to add.
-     * @return True if the FOLLOW set was modified, false otherwise.
+     * A production A -> w goes in M[A, t] for every terminal t in FIRST(w),
+     * and for every t in FOLLOW(A) if w is nullable.
      */
-    bool addToFollow(const std::string& nonTerminal, const std::string& terminal) {
-        size_t originalSize = followSets[nonTerminal].size();
-        followSets[nonTerminal].insert(terminal);
-        return followSets[nonTerminal].size() > originalSize;
+    void fillCells() {
+        const size_t terminalCount = terminals.size();
+        std::vector<ProductionId> cells(nonTerminals.size() * terminalCount, NO_PRODUCTION);
+        std::vector<uint64_t> selected(setWords);
+        for (size_t p = 0; p < productions.size(); ++p) {
+            const size_t head = productionHeads[p] - terminalCount;
+            std::fill(selected.begin(), selected.end(), 0);
+            ReversedRHS rhs = getReversedRHS(static_cast<ProductionId>(p));
+            bool bodyNullable = true;
+            for (const Symbol* it = rhs.end(); it != rhs.begin() && bodyNullable;) {
+                Symbol symbol = *--it;
+                if (isTerminal(symbol)) {
+                    selected[symbol / 64] |= uint64_t{1} << (symbol % 64);
+                    bodyNullable = false;
+                } else if (isNonTerminal(symbol)) {
+                    for (size_t w = 0; w < setWords; ++w) {
+                        selected[w] |= firstBits[(symbol - terminalCount) * setWords + w];
+                    }
+                    bodyNullable = nullable[symbol - terminalCount];
+                }
+            }
+            if (bodyNullable) {
+                for (size_t w = 0; w < setWords; ++w) {
+                    selected[w] |= followBits[head * setWords + w];
+                }
+            }
+            for (size_t t = 0; t < terminalCount; ++t) {
+                if (!((selected[t / 64] >> (t % 64)) & 1)) continue;
+                ProductionId& cell = cells[head * terminalCount + t];
+                if (cell == NO_PRODUCTION) {
+                    cell = static_cast<ProductionId>(p);
+                } else {
+                    conflicts.push_back("M[" + nonTerminals[head] + ", " + terminals[t] + "]: " +
+                                        productions[cell] + " | " + productions[p]);
+                }
+            }
+        }
+        compressCells(cells);
     }
 
 public:
     /**
-     * @brief Constructs a ParsingTable by loading from a CSV file.
+     * @brief Constructs a ParsingTable by loading from a CSV file or a .grm grammar file.
      *
      * Initializes the parsing table, and computes the FIRST and FOLLOW sets.
+     * For a grammar, the table is then computed from them; see getConflicts().
      *
-     * @param filename The CSV file name from which the parsing table is loaded.
-     * @throws std::runtime_error If the CSV file cannot be loaded.
+     * @param filename The CSV or .grm file from which the parsing table is loaded.
+     * @throws std::runtime_error If the file cannot be loaded.
      */
     ParsingTable(const std::string& filename = "LL1_parsing_table.csv") {
-        if (!loadFromCSV(filename)) {
-            throw std::runtime_error("Failed to load parsing table from CSV file: " + filename);
+        const bool grammar = filename.size() >= 4 && filename.compare(filename.size() - 4, 4, ".grm") == 0;
+        if (grammar ? !loadFromGrammar(filename) : !loadFromCSV(filename)) {
+            throw std::runtime_error("Failed to load parsing table from file: " + filename);
+        }
+        if (startSymbol == NO_SYMBOL || endSymbol == NO_SYMBOL) {
+            throw std::runtime_error("Parsing table has no START row or $ column: " + filename);
+        }
+        computeSets();
+        if (grammar) {
+            fillCells();
         }
-        computeFirstSets();
-        computeFollowSets();
+    }
+
+    /**
+     * @brief Constructs a ParsingTable from a table compiled in at build time.
+     *
+     * The data is copied as is; nothing is parsed or computed.
+     *
+     * @param compiled The compiled table.
+     */
+    explicit ParsingTable(const Compiled& compiled) {
+        for (size_t i = 0; i < compiled.symbolCount; ++i) {
+            addSymbol(compiled.symbolNames[i]);
+        }
+        terminals.assign(symbolNames.begin(), symbolNames.begin() + compiled.terminalCount);
+        nonTerminals.assign(symbolNames.begin() + compiled.terminalCount,
+                            symbolNames.begin() + compiled.terminalCount + compiled.nonTerminalCount);
+        productions.assign(compiled.productions, compiled.productions + compiled.productionCount);
+        productionHeads.assign(compiled.productionHeads, compiled.productionHeads + compiled.productionCount);
+        rhsStarts.assign(compiled.rhsStarts, compiled.rhsStarts + compiled.productionCount + 1);
+        rhsSymbols.assign(compiled.rhsSymbols, compiled.rhsSymbols + rhsStarts.back());
+        derivationTexts.assign(compiled.derivationTexts, compiled.derivationTexts + compiled.productionCount);
+        rowOffsets.assign(compiled.rowOffsets, compiled.rowOffsets + compiled.nonTerminalCount);
+        packedCells.assign(compiled.packedCells, compiled.packedCells + compiled.packedCellCount);
+        setWords = compiled.setWords;
+        firstBits.assign(compiled.firstSets, compiled.firstSets + compiled.nonTerminalCount * setWords);
+        followBits.assign(compiled.followSets, compiled.followSets + compiled.nonTerminalCount * setWords);
+        nullable.assign(compiled.nullable, compiled.nullable + compiled.nonTerminalCount);
+        indexTerminals();
     }
 
     /**
      * @brief Loads the parsing table from a CSV file.
      *
-     * Parses the header to get terminal symbols and the subsequent rows for productions.
+     * Parses the header to get terminal symbols and the subsequent rows for productions,
+     * then numbers the symbols and fills the dense table.
      *
      * @param filename The CSV file to load.
      * @return True if the file was successfully loaded, false otherwise.
@@ -250,26 +595,292 @@ public:
         terminals.erase(terminals.begin());
 
         // Read each production line.
+        std::vector<std::vector<std::string>> rows;
         std::string line;
         while (std::getline(file, line)) {
             auto tokens = splitCSVLine(line);
             if (tokens.empty()) continue;
+            rows.push_back(std::move(tokens));
+        }
 
+        // Number terminals, then non-terminals, so each kind is one range of IDs.
+        for (const auto& terminal : terminals) {
+            addSymbol(terminal);
+        }
+        for (const auto& row : rows) {
             // First token is the non-terminal.
-            std::string nonTerminal = tokens[0];
-            nonTerminals.push_back(nonTerminal);
+            if (symbolIds.find(row[0]) == symbolIds.end()) {
+                addSymbol(row[0]);
+                nonTerminals.push_back(row[0]);
+            }
+        }
+        if (symbolNames.size() > NO_SYMBOL) {
+            std::cerr << "Too many grammar symbols in: " << filename << std::endl;
+            return false;
+        }
+
+        // Process each terminal column and add production.
+        std::vector<ProductionId> cells(nonTerminals.size() * terminals.size(), NO_PRODUCTION);
+        std::unordered_map<std::string, ProductionId> productionIds;
+        for (const auto& row : rows) {
+            size_t rowBase = (symbolIds[row[0]] - terminals.size()) * terminals.size();
+            for (size_t i = 1; i < row.size() && i <= terminals.size(); ++i) {
+                if (row[i].empty()) continue;
+                auto [it, added] = productionIds.emplace(row[i], static_cast<ProductionId>(productions.size()));
+                if (added) {
+                    productions.push_back(row[i]);
+                    productionHeads.push_back(symbolIds[row[0]]);
+                }
+                cells[rowBase + i - 1] = it->second;
+            }
+        }
+        if (productions.size() > NO_PRODUCTION) {
+            std::cerr << "Too many productions in: " << filename << std::endl;
+            return false;
+        }
+        compressCells(cells);
+
+        if (!splitProductions()) {
+            std::cerr << "Too many grammar symbols in: " << filename << std::endl;
+            return false;
+        }
+
+        indexTerminals();
+        return true;
+    }
+
+    /**
+     * @brief Loads the productions of a .grm grammar file.
+     *
+     * A rule is a non-terminal, "->", and alternatives separated by "|", ending
+     * with "." (e.g. "PROG -> CLASSIMPLFUNC _addToProgram PROG | ."). An empty
+     * alternative, or "&epsilon", is an epsilon production; so is one made of
+     * semantic actions only, and its text says so. Symbols starting
+     * with '_' are semantic actions, and the other symbols that head no rule
+     * are terminals. The "$" column comes first, followed by the terminals in
+     * order of first use, and the rows follow the order of the rules.
+     *
+     * The cells are filled once the FIRST and FOLLOW sets are known; see
+     * fillCells().
+     *
+     * @param filename The grammar file to load.
+     * @return True if the file was successfully loaded, false otherwise.
+     */
+    bool loadFromGrammar(const std::string& filename) {
+        std::ifstream file(filename);
+        if (!file.is_open()) {
+            std::cerr << "Failed to open file: " << filename << std::endl;
+            return false;
+        }
+
+        // Read every rule into one production per alternative.
+        std::vector<std::pair<std::string, std::vector<std::string>>> bodies;
+        std::string head;
+        while (file >> head) {
+            std::string arrow;
+            if (!(file >> arrow) || arrow != "->") {
+                std::cerr << "Expected -> after " << head << " in: " << filename << std::endl;
+                return false;
+            }
+            bodies.emplace_back(head, std::vector<std::string>());
+            std::string symbol;
+            bool terminated = false;
+            while (!terminated && file >> symbol) {
+                // The final "." may be written right after the last symbol.
+                if (symbol.size() > 1 && symbol.back() == '.') {
+                    symbol.pop_back();
+                    terminated = true;
+                }
+                if (symbol == ".") {
+                    terminated = true;
+                } else if (symbol == "|") {
+                    bodies.emplace_back(head, std::vector<std::string>());
+                } else if (symbol != "&epsilon") {
+                    bodies.back().second.push_back(symbol);
+                }
+            }
+            if (!terminated) {
+                std::cerr << "Rule for " << head << " does not end with . in: " << filename << std::endl;
+                return false;
+            }
+        }
 
-            // Process each terminal column and add production.
-            for (size_t i = 1; i < tokens.size() && i <= terminals.size(); ++i) {
-                if (!tokens[i].empty()) {
-                    table[nonTerminal][terminals[i-1]] = tokens[i];
+        // Number terminals, then non-terminals, so each kind is one range of IDs.
+        std::unordered_set<std::string> heads;
+        for (const auto& [nonTerminal, body] : bodies) {
+            if (heads.insert(nonTerminal).second) {
+                nonTerminals.push_back(nonTerminal);
+            }
+        }
+        terminals.push_back("$");
+        for (const auto& [nonTerminal, body] : bodies) {
+            for (const auto& symbol : body) {
+                if (symbol[0] != '_' && heads.find(symbol) == heads.end() &&
+                    std::find(terminals.begin(), terminals.end(), symbol) == terminals.end()) {
+                    terminals.push_back(symbol);
                 }
             }
         }
+        for (const auto& terminal : terminals) {
+            addSymbol(terminal);
+        }
+        for (const auto& nonTerminal : nonTerminals) {
+            addSymbol(nonTerminal);
+        }
+
+        // Productions are numbered in grammar order; equal productions share one ID.
+        std::unordered_map<std::string, ProductionId> productionIds;
+        for (const auto& [nonTerminal, body] : bodies) {
+            std::string production = nonTerminal + " ->";
+            bool epsilon = true;
+            for (const auto& symbol : body) {
+                production += " " + symbol;
+                epsilon &= symbol[0] == '_';
+            }
+            if (epsilon) {
+                production += " &epsilon";
+            }
+            if (productionIds.emplace(production, static_cast<ProductionId>(productions.size())).second) {
+                productions.push_back(production);
+                productionHeads.push_back(symbolIds[nonTerminal]);
+            }
+        }
+        if (productions.size() > NO_PRODUCTION || !splitProductions()) {
+            std::cerr << "Too many grammar symbols or productions in: " << filename << std::endl;
+            return false;
+        }
 
+        indexTerminals();
         return true;
     }
 
+    /**
+     * @brief Retrieves the ID of a symbol.
+     *
+     * @param name The symbol name.
+     * @return The ID of the symbol, or NO_SYMBOL if it is not part of the grammar.
+     */
+    Symbol getSymbol(const std::string& name) const {
+        auto it = symbolIds.find(name);
+        return it != symbolIds.end() ? it->second : NO_SYMBOL;
+    }
+
+    /// Retrieves the number of symbols: terminals, non-terminals and actions.
+    size_t getSymbolCount() const { return symbolNames.size(); }
+
+    /// Retrieves the number of distinct productions.
+    size_t getProductionCount() const { return productions.size(); }
+
+    /**
+     * @brief Retrieves the name of a symbol.
+     *
+     * @param symbol A symbol ID.
+     * @return The symbol name.
+     */
+    const std::string& getSymbolName(Symbol symbol) const { return symbolNames[symbol]; }
+
+    /**
+     * @brief Retrieves the terminal a token kind is matched as.
+     *
+     * @param kind The token kind.
+     * @return The terminal ID, or NO_SYMBOL if no column of the table has that kind.
+     */
+    Symbol getTerminal(TokenType kind) const { return terminalOfKind[static_cast<size_t>(kind)]; }
+
+    /// Retrieves the ID of the START non-terminal.
+    Symbol getStartSymbol() const { return startSymbol; }
+
+    /// Retrieves the ID of the end marker "$".
+    Symbol getEndSymbol() const { return endSymbol; }
+
+    /**
+     * @brief Checks if a symbol ID is a terminal.
+     */
+    bool isTerminal(Symbol symbol) const { return symbol < terminals.size(); }
+
+    /**
+     * @brief Checks if a symbol ID is a non-terminal.
+     */
+    bool isNonTerminal(Symbol symbol) const {
+        return symbol >= terminals.size() && symbol < terminals.size() + nonTerminals.size();
+    }
+
+    /**
+     * @brief Checks if a symbol ID is a semantic action.
+     */
+    bool isAction(Symbol symbol) const {
+        return symbol >= terminals.size() + nonTerminals.size() && symbol < symbolNames.size();
+    }
+
+    /**
+     * @brief Retrieves the production for a non-terminal and a terminal.
+     *
+     * @param nonTerminal A non-terminal ID.
+     * @param terminal A terminal ID, or NO_SYMBOL.
+     * @return The production ID, or NO_PRODUCTION if the cell is empty.
+     */
+    ProductionId getProduction(Symbol nonTerminal, Symbol terminal) const {
+        if (terminal >= terminals.size()) {
+            return NO_PRODUCTION;
+        }
+        const size_t row = nonTerminal - terminals.size();
+        const PackedCell& cell = packedCells[rowOffsets[row] + terminal];
+        return cell.row == row ? cell.production : NO_PRODUCTION;
+    }
+
+    /// Retrieves the offset of each non-terminal row in the row-displacement table.
+    const std::vector<uint32_t>& getRowOffsets() const { return rowOffsets; }
+
+    /// Retrieves the slots of the row-displacement table.
+    const std::vector<PackedCell>& getPackedCells() const { return packedCells; }
+
+    /**
+     * @brief Retrieves the text of a production, e.g. "PROG -> CLASSIMPLFUNC _addToProgram PROG".
+     *
+     * @param production A production ID.
+     * @return The production as written in the table.
+     */
+    const std::string& getProductionText(ProductionId production) const { return productions[production]; }
+
+    /**
+     * @brief Retrieves the non-terminal a production expands.
+     *
+     * @param production A production ID.
+     * @return The ID of the left-hand side non-terminal.
+     */
+    Symbol getProductionHead(ProductionId production) const { return productionHeads[production]; }
+
+    /**
+     * @brief Right-hand side symbols of a production, last symbol first.
+     */
+    struct ReversedRHS {
+        const Symbol* first; ///< First symbol to push
+        const Symbol* last;  ///< One past the last symbol to push
+
+        const Symbol* begin() const { return first; }
+        const Symbol* end() const { return last; }
+        size_t size() const { return static_cast<size_t>(last - first); }
+    };
+
+    /**
+     * @brief Retrieves the right-hand side of a production in the order it is pushed on the parse stack.
+     *
+     * @param production A production ID.
+     * @return The symbols, reversed, without &epsilon.
+     */
+    ReversedRHS getReversedRHS(ProductionId production) const {
+        const Symbol* base = rhsSymbols.data();
+        return {base + rhsStarts[production], base + rhsStarts[production + 1]};
+    }
+
+    /**
+     * @brief Retrieves the text that replaces the non-terminal when the production is applied to the derivation.
+     *
+     * @param production A production ID.
+     * @return The grammar symbols of the right-hand side, each preceded by a space, or an empty string for &epsilon.
+     */
+    const std::string& getDerivationText(ProductionId production) const { return derivationTexts[production]; }
+
     /**
      * @brief Retrieves a production for a given non-terminal and terminal.
      *
@@ -281,17 +892,17 @@ public:
      */
     std::string getProduction(const std::string& nonTerminal, 
                               const std::string& terminal) const {
-        auto ntIt = table.find(nonTerminal);
-        if (ntIt == table.end()) {
+        Symbol nt = getSymbol(nonTerminal);
+        if (!isNonTerminal(nt)) {
             return "error"; // Non-terminal not found
         }
 
-        auto termIt = ntIt->second.find(terminal);
-        if (termIt == ntIt->second.end()) {
+        ProductionId production = getProduction(nt, getSymbol(terminal));
+        if (production == NO_PRODUCTION) {
             return "error"; // Terminal not found for this non-terminal
         }
 
-        return termIt->second;
+        return productions[production];
     }
 
     /**
@@ -315,7 +926,7 @@ public:
      * @return True if the symbol is a terminal, false otherwise.
      */
     bool isTerminal(const std::string& symbol) const {
-        return std::find(terminals.begin(), terminals.end(), symbol) != terminals.end();
+        return isTerminal(getSymbol(symbol));
     }
 
     /**
@@ -325,7 +936,7 @@ public:
      * @return True if the symbol is a non-terminal, false otherwise.
      */
     bool isNonTerminal(const std::string& symbol) const {
-        return std::find(nonTerminals.begin(), nonTerminals.end(), symbol) != nonTerminals.end();
+        return isNonTerminal(getSymbol(symbol));
     }
 
     /**
@@ -350,11 +961,14 @@ public:
      * @return True if terminal is in the FIRST set, false otherwise.
      */
     bool isInFirst(const std::string& nonTerminal, const std::string& terminal) const {
-        auto it = firstSets.find(nonTerminal);
-        if (it != firstSets.end()) {
-            return it->second.find(terminal) != it->second.end();
-        }
-        return false;
+        return isInFirst(getSymbol(nonTerminal), getSymbol(terminal));
+    }
+
+    /**
+     * @brief Checks if a terminal ID is in the FIRST set of a non-terminal ID.
+     */
+    bool isInFirst(Symbol nonTerminal, Symbol terminal) const {
+        return isNonTerminal(nonTerminal) && isTerminal(terminal) && testBit(firstBits, nonTerminal, terminal);
     }
     
     /**
@@ -365,11 +979,14 @@ public:
      * @return True if terminal is in the FOLLOW set, false otherwise.
      */
     bool isInFollow(const std::string& nonTerminal, const std::string& terminal) const {
-        auto it = followSets.find(nonTerminal);
-        if (it != followSets.end()) {
-            return it->second.find(terminal) != it->second.end();
-        }
-        return false;
+        return isInFollow(getSymbol(nonTerminal), getSymbol(terminal));
+    }
+
+    /**
+     * @brief Checks if a terminal ID is in the FOLLOW set of a non-terminal ID.
+     */
+    bool isInFollow(Symbol nonTerminal, Symbol terminal) const {
+        return isNonTerminal(nonTerminal) && isTerminal(terminal) && testBit(followBits, nonTerminal, terminal);
     }
 
     /**
@@ -377,11 +994,15 @@ public:
      *
      * @param nonTerminal The non-terminal whose productions are printed.
      */
-    void printProductions(const std::string& nonTerminal) {
+    void printProductions(const std::string& nonTerminal) const {
         std::cout << "Productions for " << nonTerminal << ":\n";
-        if (table.find(nonTerminal) != table.end()) {
-            for (const auto& [terminal, prod] : table[nonTerminal]) {
-                std::cout << "  On " << terminal << ": " << prod << "\n";
+        Symbol nt = getSymbol(nonTerminal);
+        if (isNonTerminal(nt)) {
+            for (Symbol terminal = 0; terminal < terminals.size(); ++terminal) {
+                ProductionId prod = getProduction(nt, terminal);
+                if (prod != NO_PRODUCTION) {
+                    std::cout << "  On " << terminals[terminal] << ": " << productions[prod] << "\n";
+                }
             }
         } else {
             std::cout << "  No productions found\n";
@@ -395,17 +1016,28 @@ public:
      * @return True if epsilon is present in the FIRST set, false otherwise.
      */
     bool hasEpsilon(const std::string& nonTerminal) const {
-        auto it = firstSets.find(nonTerminal);
-        if (it != firstSets.end()) {
-            return it->second.find("&epsilon") != it->second.end();
-        }
-        return false;
+        return hasEpsilon(getSymbol(nonTerminal));
     }
 
+    /**
+     * @brief Checks if the FIRST set of a non-terminal ID contains the epsilon symbol.
+     */
+    bool hasEpsilon(Symbol nonTerminal) const {
+        return isNonTerminal(nonTerminal) && nullable[nonTerminal - terminals.size()];
+    }
+
+    /**
+     * @brief Retrieves the LL(1) conflicts found while computing the table from a grammar.
+     *
+     * @return One "M[A, t]: kept production | dropped production" entry per
+     *         conflicting cell; empty for a CSV or compiled table.
+     */
+    const std::vector<std::string>& getConflicts() const { return conflicts; }
+
     /**
      * @brief Get first set
      */
-    std::vector<std::string> getFirstSet(const std::string& nonTerminal) {
+    std::vector<std::string> getFirstSet(const std::string& nonTerminal) const {
         std::vector<std::string> result;
         // Iterate through all terminals to find which ones are in FIRST(nonTerminal)
         for (const auto& terminal : terminals) {
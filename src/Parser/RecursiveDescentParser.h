@@ -0,0 +1,104 @@
+/**
+ * @file RecursiveDescentParser.h
+ * @brief Base class of the recursive-descent parsers generated by parsergen.
+ *
+ * A generated parser has one function per non-terminal that switches on the
+ * lookahead token kind to pick a production, then matches its terminals,
+ * calls the functions of its non-terminals and performs its semantic actions
+ * in order. The primitives it needs, such as matching a token or performing
+ * an action, are defined here on top of the Parser that owns the tokens, the
+ * AST and the error list, so the generated code reaches exactly the same
+ * decisions as the table-driven parse.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#ifndef RECURSIVEDESCENTPARSER_H
+#define RECURSIVEDESCENTPARSER_H
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include "Parser.h"
+
+/**
+ * @class RecursiveDescentParser
+ * @brief Token matching, semantic actions and error reporting for generated parsers.
+ */
+class RecursiveDescentParser {
+public:
+    /**
+     * @brief Creates a parser working on the state of the given parser.
+     * @param parser The parser whose lookahead, AST and outputs are used; its
+     *               first lookahead token must already have been read.
+     */
+    explicit RecursiveDescentParser(Parser& parser) : parser(parser) {}
+
+protected:
+    /**
+     * @brief Retrieves the kind of the lookahead token.
+     */
+    TokenType lookaheadKind() const { return parser.lookahead.kind; }
+
+    /**
+     * @brief Consumes the lookahead token if it has the expected kind.
+     * @param kind The token kind the grammar expects.
+     * @return true if it matched; otherwise the error is reported.
+     */
+    bool match(TokenType kind) {
+        if (parser.lookahead.kind != kind) {
+            const ParsingTable::Symbol expected = parser.table->getTerminal(kind);
+            const std::string& name = parser.table->getSymbolName(expected);
+            std::cout << "Error: Expected " << name << " but got " << parser.lookahead.type << std::endl;
+            parser.syntaxErrors.push_back("Error: Expected " + name + " but got " + std::string(parser.lookahead.type));
+            parser.reportSyntaxError(expected);
+            return false;
+        }
+        currentLexeme = parser.lookahead.lexeme;
+        currentSymbol = parser.lookahead.symbol;
+        currentLiteral = parser.lookahead.literal;
+        parser.lookahead = parser.nextToken();
+        return true;
+    }
+
+    /**
+     * @brief Reports that no production of a non-terminal starts with the lookahead.
+     * @param nonTerminal The non-terminal being expanded.
+     * @return false, so generated code can return it directly.
+     */
+    bool noProduction(ParsingTable::Symbol nonTerminal) {
+        const std::string& name = parser.table->getSymbolName(nonTerminal);
+        std::cout << "No production found for " << name << " with lookahead " << parser.lookahead.type << std::endl;
+        parser.syntaxErrors.push_back("No production found for " + name + " with lookahead " +
+                                      std::string(parser.lookahead.type));
+        parser.reportSyntaxError(nonTerminal);
+        return false;
+    }
+
+    /**
+     * @brief Records a production as applied, if the parser records the derivation.
+     * @param production The ID of the production in the parsing table.
+     */
+    void derive(ParsingTable::ProductionId production) {
+        if (parser.recordDerivation) {
+            parser.appliedProductions.push_back(production);
+        }
+    }
+
+    /**
+     * @brief Performs a semantic action with the most recently matched token.
+     * @param action The action to perform.
+     */
+    void act(SemanticAction action) {
+        parser.ast.performAction(action, currentLexeme, parser.lookahead.line, currentSymbol, currentLiteral);
+    }
+
+private:
+    Parser& parser;                     ///< Parser whose state is used
+    std::string_view currentLexeme;     ///< Lexeme of the last matched token
+    SymbolId currentSymbol = NO_SYMBOL; ///< Interned identifier of the last matched token
+    LiteralValue currentLiteral;        ///< Decoded value of the last matched token
+};
+
+#endif // RECURSIVEDESCENTPARSER_H
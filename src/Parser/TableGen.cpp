@@ -0,0 +1,166 @@
+/**
+ * @file TableGen.cpp
+ * @brief Build-time tool that compiles a parsing table CSV file or a grammar into a C++ header.
+ *
+ * The table is loaded with ParsingTable, so the symbols, productions, FIRST
+ * and FOLLOW sets are exactly the ones the parser would compute at startup.
+ * They are written out as constant arrays and a ParsingTable::Compiled that
+ * points at them.
+ *
+ * Given a .grm grammar, the LL(1) table is computed from it. Every conflict is
+ * reported and fails the build, since the grammar would then not be LL(1).
+ *
+ * Usage: tablegen <table.csv | grammar.grm> <output.h> <namespace>
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#include "Parser/ParsingTable.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Writes a string as a C++ string literal.
+ */
+std::string quote(const std::string& text) {
+    std::string literal = "\"";
+    for (char ch : text) {
+        if (ch == '"' || ch == '\\') {
+            literal += '\\';
+        }
+        literal += ch;
+    }
+    return literal + "\"";
+}
+
+/**
+ * @brief Writes a constant array definition, ten values per line.
+ */
+template <typename T>
+void writeArray(std::ostream& out, const std::string& type, const std::string& name, const std::vector<T>& values) {
+    out << "inline constexpr " << type << " " << name << "[] = {";
+    for (size_t i = 0; i < values.size(); ++i) {
+        out << (i % 10 == 0 ? "\n    " : " ") << values[i] << ",";
+    }
+    if (values.empty()) {
+        out << "\n    0,"; // Arrays cannot be empty
+    }
+    out << "\n};\n\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc != 4) {
+        std::cerr << "Usage: " << argv[0] << " <table.csv | grammar.grm> <output.h> <namespace>\n";
+        return 1;
+    }
+    const std::string inputFile = argv[1];
+    const std::string outputFile = argv[2];
+    const std::string name = argv[3];
+
+    try {
+        ParsingTable table(inputFile);
+        if (!table.getConflicts().empty()) {
+            for (const std::string& conflict : table.getConflicts()) {
+                std::cerr << inputFile << ": LL(1) conflict in " << conflict << std::endl;
+            }
+            std::cerr << "Error: " << table.getConflicts().size() << " LL(1) conflicts in " << inputFile << std::endl;
+            return 1;
+        }
+        const size_t terminalCount = table.getTerminals().size();
+        const size_t nonTerminalCount = table.getNonTerminals().size();
+        const size_t setWords = (terminalCount + 63) / 64;
+
+        std::vector<std::string> symbolNames;
+        for (size_t symbol = 0; symbol < table.getSymbolCount(); ++symbol) {
+            symbolNames.push_back(quote(table.getSymbolName(static_cast<ParsingTable::Symbol>(symbol))));
+        }
+
+        std::vector<std::string> productions, derivationTexts;
+        std::vector<unsigned> productionHeads, rhsStarts, rhsSymbols;
+        for (size_t id = 0; id < table.getProductionCount(); ++id) {
+            auto production = static_cast<ParsingTable::ProductionId>(id);
+            productions.push_back(quote(table.getProductionText(production)));
+            derivationTexts.push_back(quote(table.getDerivationText(production)));
+            productionHeads.push_back(table.getProductionHead(production));
+            rhsStarts.push_back(static_cast<unsigned>(rhsSymbols.size()));
+            for (ParsingTable::Symbol symbol : table.getReversedRHS(production)) {
+                rhsSymbols.push_back(symbol);
+            }
+        }
+        rhsStarts.push_back(static_cast<unsigned>(rhsSymbols.size()));
+
+        std::vector<unsigned> rowOffsets(table.getRowOffsets().begin(), table.getRowOffsets().end()), nullable;
+        std::vector<std::string> packedCells;
+        for (const ParsingTable::PackedCell& cell : table.getPackedCells()) {
+            packedCells.push_back("{" + std::to_string(cell.row) + ", " + std::to_string(cell.production) + "}");
+        }
+        std::vector<std::string> firstSets(nonTerminalCount * setWords), followSets(nonTerminalCount * setWords);
+        for (size_t nt = 0; nt < nonTerminalCount; ++nt) {
+            auto nonTerminal = static_cast<ParsingTable::Symbol>(terminalCount + nt);
+            std::vector<uint64_t> first(setWords), follow(setWords);
+            for (size_t t = 0; t < terminalCount; ++t) {
+                auto terminal = static_cast<ParsingTable::Symbol>(t);
+                first[t / 64] |= uint64_t{table.isInFirst(nonTerminal, terminal)} << (t % 64);
+                follow[t / 64] |= uint64_t{table.isInFollow(nonTerminal, terminal)} << (t % 64);
+            }
+            for (size_t w = 0; w < setWords; ++w) {
+                firstSets[nt * setWords + w] = std::to_string(first[w]) + "ull";
+                followSets[nt * setWords + w] = std::to_string(follow[w]) + "ull";
+            }
+            nullable.push_back(table.hasEpsilon(nonTerminal));
+        }
+
+        std::ofstream out(outputFile);
+        if (!out.is_open()) {
+            std::cerr << "Failed to open output file: " << outputFile << std::endl;
+            return 1;
+        }
+        std::string guard = name;
+        std::transform(guard.begin(), guard.end(), guard.begin(), [](unsigned char c) { return std::toupper(c); });
+        guard += "_H";
+
+        out << "/**\n"
+            << " * @file " << std::filesystem::path(outputFile).filename().string() << "\n"
+            << " * @brief Parsing table compiled from " << std::filesystem::path(inputFile).filename().string() << ".\n"
+            << " *\n"
+            << " * Generated by tablegen at build time. Do not edit.\n"
+            << " */\n\n"
+            << "#ifndef " << guard << "\n"
+            << "#define " << guard << "\n\n"
+            << "#include \"Parser/ParsingTable.h\"\n\n"
+            << "namespace " << name << " {\n\n";
+        writeArray(out, "const char*", "symbolNames", symbolNames);
+        writeArray(out, "const char*", "productions", productions);
+        writeArray(out, "ParsingTable::Symbol", "productionHeads", productionHeads);
+        writeArray(out, "uint32_t", "rhsStarts", rhsStarts);
+        writeArray(out, "ParsingTable::Symbol", "rhsSymbols", rhsSymbols);
+        writeArray(out, "const char*", "derivationTexts", derivationTexts);
+        writeArray(out, "uint32_t", "rowOffsets", rowOffsets);
+        writeArray(out, "ParsingTable::PackedCell", "packedCells", packedCells);
+        writeArray(out, "uint64_t", "firstSets", firstSets);
+        writeArray(out, "uint64_t", "followSets", followSets);
+        writeArray(out, "uint8_t", "nullable", nullable);
+        out << "inline constexpr ParsingTable::Compiled table = {\n"
+            << "    " << terminalCount << ", " << nonTerminalCount << ", " << table.getSymbolCount() << ", symbolNames,\n"
+            << "    " << table.getProductionCount() << ", productions, productionHeads, rhsStarts, rhsSymbols, derivationTexts,\n"
+            << "    rowOffsets, " << packedCells.size() << ", packedCells, " << setWords << ", firstSets, followSets, nullable,\n"
+            << "};\n\n"
+            << "} // namespace " << name << "\n\n"
+            << "#endif // " << guard << "\n";
+        return out ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,304 @@
+/**
+ * @file CharScan.cpp
+ * @brief Scalar, SSE2 and AVX2 implementations of the CharScan kernels.
+ *
+ * Each vector kernel classifies a whole block with byte compares, turns the
+ * result into a bit mask with movemask and uses count-trailing-zeros to find
+ * the first interesting byte, or popcount to count newlines. Bytes left over
+ * after the last full block are handled by the scalar kernel.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#include "CharScan.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CHARSCAN_X86 1
+#include <immintrin.h>
+#endif
+
+namespace CharScan {
+
+namespace {
+
+// ---------------------------------------------------------------------------
+// Scalar kernels
+// ---------------------------------------------------------------------------
+
+inline bool isWhitespace(char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+inline bool isIdentifierChar(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+           (c >= '0' && c <= '9') || c == '_';
+}
+
+const char* skipWhitespaceScalar(const char* p, const char* end) {
+    while (p < end && isWhitespace(*p)) ++p;
+    return p;
+}
+
+const char* skipIdentifierCharsScalar(const char* p, const char* end) {
+    while (p < end && isIdentifierChar(*p)) ++p;
+    return p;
+}
+
+const char* findCommentDelimiterScalar(const char* p, const char* end) {
+    while (p < end && *p != '*' && *p != '/') ++p;
+    return p;
+}
+
+const char* findNewlineScalar(const char* p, const char* end) {
+    while (p < end && *p != '\n') ++p;
+    return p;
+}
+
+size_t countNewlinesScalar(const char* p, const char* end) {
+    size_t count = 0;
+    for (; p < end; ++p) count += (*p == '\n');
+    return count;
+}
+
+#ifdef CHARSCAN_X86
+
+// ---------------------------------------------------------------------------
+// SSE2 kernels (16 bytes per step)
+// ---------------------------------------------------------------------------
+
+/// Bytes of v in [lo, hi], as 0xFF lanes.
+inline __m128i inRange16(__m128i v, char lo, char hi) {
+    __m128i offset = _mm_sub_epi8(v, _mm_set1_epi8(lo));
+    return _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(static_cast<char>(hi - lo))), offset);
+}
+
+inline unsigned whitespaceMask16(const char* p) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    __m128i space = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), inRange16(v, '\t', '\r'));
+    return static_cast<unsigned>(_mm_movemask_epi8(space));
+}
+
+inline unsigned identifierMask16(const char* p) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    __m128i letter = inRange16(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 'z');
+    __m128i digit = inRange16(v, '0', '9');
+    __m128i underscore = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(letter, digit), underscore)));
+}
+
+inline unsigned byteMask16(const char* p, char c) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(c))));
+}
+
+const char* skipWhitespaceSse2(const char* p, const char* end) {
+    for (; end - p >= 16; p += 16) {
+        unsigned stop = ~whitespaceMask16(p) & 0xFFFFu;
+        if (stop) return p + __builtin_ctz(stop);
+    }
+    return skipWhitespaceScalar(p, end);
+}
+
+const char* skipIdentifierCharsSse2(const char* p, const char* end) {
+    for (; end - p >= 16; p += 16) {
+        unsigned stop = ~identifierMask16(p) & 0xFFFFu;
+        if (stop) return p + __builtin_ctz(stop);
+    }
+    return skipIdentifierCharsScalar(p, end);
+}
+
+const char* findCommentDelimiterSse2(const char* p, const char* end) {
+    for (; end - p >= 16; p += 16) {
+        unsigned found = byteMask16(p, '*') | byteMask16(p, '/');
+        if (found) return p + __builtin_ctz(found);
+    }
+    return findCommentDelimiterScalar(p, end);
+}
+
+const char* findNewlineSse2(const char* p, const char* end) {
+    for (; end - p >= 16; p += 16) {
+        unsigned found = byteMask16(p, '\n');
+        if (found) return p + __builtin_ctz(found);
+    }
+    return findNewlineScalar(p, end);
+}
+
+size_t countNewlinesSse2(const char* p, const char* end) {
+    size_t count = 0;
+    for (; end - p >= 16; p += 16) {
+        count += __builtin_popcount(byteMask16(p, '\n'));
+    }
+    return count + countNewlinesScalar(p, end);
+}
+
+// ---------------------------------------------------------------------------
+// AVX2 kernels (32 bytes per step)
+// ---------------------------------------------------------------------------
+
+#define CHARSCAN_AVX2 __attribute__((target("avx2,popcnt")))
+
+CHARSCAN_AVX2 inline __m256i inRange32(__m256i v, char lo, char hi) {
+    __m256i offset = _mm256_sub_epi8(v, _mm256_set1_epi8(lo));
+    return _mm256_cmpeq_epi8(_mm256_min_epu8(offset, _mm256_set1_epi8(static_cast<char>(hi - lo))), offset);
+}
+
+CHARSCAN_AVX2 inline unsigned whitespaceMask32(const char* p) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    __m256i space = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')), inRange32(v, '\t', '\r'));
+    return static_cast<unsigned>(_mm256_movemask_epi8(space));
+}
+
+CHARSCAN_AVX2 inline unsigned identifierMask32(const char* p) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    __m256i letter = inRange32(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), 'a', 'z');
+    __m256i digit = inRange32(v, '0', '9');
+    __m256i underscore = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_'));
+    return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(letter, digit), underscore)));
+}
+
+CHARSCAN_AVX2 inline unsigned byteMask32(const char* p, char c) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(c))));
+}
+
+CHARSCAN_AVX2 const char* skipWhitespaceAvx2(const char* p, const char* end) {
+    for (; end - p >= 32; p += 32) {
+        unsigned stop = ~whitespaceMask32(p);
+        if (stop) return p + __builtin_ctz(stop);
+    }
+    return skipWhitespaceScalar(p, end);
+}
+
+CHARSCAN_AVX2 const char* skipIdentifierCharsAvx2(const char* p, const char* end) {
+    for (; end - p >= 32; p += 32) {
+        unsigned stop = ~identifierMask32(p);
+        if (stop) return p + __builtin_ctz(stop);
+    }
+    return skipIdentifierCharsScalar(p, end);
+}
+
+CHARSCAN_AVX2 const char* findCommentDelimiterAvx2(const char* p, const char* end) {
+    for (; end - p >= 32; p += 32) {
+        unsigned found = byteMask32(p, '*') | byteMask32(p, '/');
+        if (found) return p + __builtin_ctz(found);
+    }
+    return findCommentDelimiterScalar(p, end);
+}
+
+CHARSCAN_AVX2 const char* findNewlineAvx2(const char* p, const char* end) {
+    for (; end - p >= 32; p += 32) {
+        unsigned found = byteMask32(p, '\n');
+        if (found) return p + __builtin_ctz(found);
+    }
+    return findNewlineScalar(p, end);
+}
+
+CHARSCAN_AVX2 size_t countNewlinesAvx2(const char* p, const char* end) {
+    size_t count = 0;
+    for (; end - p >= 32; p += 32) {
+        count += __builtin_popcount(byteMask32(p, '\n'));
+    }
+    return count + countNewlinesScalar(p, end);
+}
+
+#undef CHARSCAN_AVX2
+
+#endif // CHARSCAN_X86
+
+// ---------------------------------------------------------------------------
+// Dispatch
+// ---------------------------------------------------------------------------
+
+struct Kernels {
+    SimdLevel level;
+    const char* (*skipWhitespace)(const char*, const char*);
+    const char* (*skipIdentifierChars)(const char*, const char*);
+    const char* (*findCommentDelimiter)(const char*, const char*);
+    const char* (*findNewline)(const char*, const char*);
+    size_t (*countNewlines)(const char*, const char*);
+};
+
+constexpr Kernels scalarKernels = {
+    SimdLevel::SCALAR, skipWhitespaceScalar, skipIdentifierCharsScalar,
+    findCommentDelimiterScalar, findNewlineScalar, countNewlinesScalar
+};
+
+#ifdef CHARSCAN_X86
+constexpr Kernels sse2Kernels = {
+    SimdLevel::SSE2, skipWhitespaceSse2, skipIdentifierCharsSse2,
+    findCommentDelimiterSse2, findNewlineSse2, countNewlinesSse2
+};
+
+constexpr Kernels avx2Kernels = {
+    SimdLevel::AVX2, skipWhitespaceAvx2, skipIdentifierCharsAvx2,
+    findCommentDelimiterAvx2, findNewlineAvx2, countNewlinesAvx2
+};
+#endif
+
+const Kernels* kernelsFor(SimdLevel level) {
+#ifdef CHARSCAN_X86
+    switch (level) {
+        case SimdLevel::AVX2: return &avx2Kernels;
+        case SimdLevel::SSE2: return &sse2Kernels;
+        default: break;
+    }
+#endif
+    (void)level;
+    return &scalarKernels;
+}
+
+const Kernels* active = kernelsFor(detectedLevel());
+
+} // namespace
+
+SimdLevel detectedLevel() {
+#ifdef CHARSCAN_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+        return SimdLevel::AVX2;
+    }
+    return SimdLevel::SSE2; // Part of the x86-64 baseline
+#else
+    return SimdLevel::SCALAR;
+#endif
+}
+
+SimdLevel activeLevel() {
+    return active->level;
+}
+
+void setLevel(SimdLevel level) {
+    SimdLevel best = detectedLevel();
+    active = kernelsFor(static_cast<int>(level) < static_cast<int>(best) ? level : best);
+}
+
+const char* levelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX2: return "avx2";
+        case SimdLevel::SSE2: return "sse2";
+        default: return "scalar";
+    }
+}
+
+const char* skipWhitespace(const char* p, const char* end) {
+    return active->skipWhitespace(p, end);
+}
+
+const char* skipIdentifierChars(const char* p, const char* end) {
+    return active->skipIdentifierChars(p, end);
+}
+
+const char* findCommentDelimiter(const char* p, const char* end) {
+    return active->findCommentDelimiter(p, end);
+}
+
+const char* findNewline(const char* p, const char* end) {
+    return active->findNewline(p, end);
+}
+
+size_t countNewlines(const char* p, const char* end) {
+    return active->countNewlines(p, end);
+}
+
+} // namespace CharScan
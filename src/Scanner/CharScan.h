@@ -0,0 +1,84 @@
+/**
+ * @file CharScan.h
+ * @brief Vectorised skipping of character runs in a source buffer.
+ *
+ * The Scanner spends most of its time walking over whitespace, identifier
+ * characters and comment text. These helpers advance over such runs 16 (SSE2)
+ * or 32 (AVX2) bytes at a time. The implementation is chosen once at startup
+ * from what the CPU supports, with a scalar fallback for other targets.
+ *
+ * Every function takes the half-open range [p, end) and returns a pointer in
+ * [p, end]; end means the run reached the end of the buffer.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#ifndef CHARSCAN_H
+#define CHARSCAN_H
+
+#include <cstddef>
+
+namespace CharScan {
+
+/**
+ * @enum SimdLevel
+ * @brief Instruction sets the kernels are available for.
+ */
+enum class SimdLevel {
+    SCALAR,
+    SSE2,
+    AVX2
+};
+
+/**
+ * @brief Returns the best level supported by the running CPU.
+ */
+SimdLevel detectedLevel();
+
+/**
+ * @brief Returns the level currently in use.
+ */
+SimdLevel activeLevel();
+
+/**
+ * @brief Selects the kernels to use, clamped to detectedLevel().
+ *
+ * Meant for tests and benchmarks; it must not be called while another thread
+ * is scanning.
+ */
+void setLevel(SimdLevel level);
+
+/**
+ * @brief Returns the name of a level ("scalar", "sse2", "avx2").
+ */
+const char* levelName(SimdLevel level);
+
+/**
+ * @brief Skips the characters isspace() accepts.
+ */
+const char* skipWhitespace(const char* p, const char* end);
+
+/**
+ * @brief Skips letters, digits and underscores.
+ */
+const char* skipIdentifierChars(const char* p, const char* end);
+
+/**
+ * @brief Finds the next '*' or '/', the only characters that matter inside a block comment.
+ */
+const char* findCommentDelimiter(const char* p, const char* end);
+
+/**
+ * @brief Finds the next newline.
+ */
+const char* findNewline(const char* p, const char* end);
+
+/**
+ * @brief Counts the newlines in [p, end).
+ */
+size_t countNewlines(const char* p, const char* end);
+
+} // namespace CharScan
+
+#endif // CHARSCAN_H
@@ -0,0 +1,110 @@
+/**
+ * @file IncrementalLexer.cpp
+ * @brief Implementation of incremental re-lexing.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#include "IncrementalLexer.h"
+#include "CharScan.h"
+#include <algorithm>
+
+namespace {
+
+bool sameToken(const PackedToken& a, const PackedToken& b) {
+    return a.offset == b.offset && a.length == b.length && a.line == b.line &&
+           a.kind == b.kind && a.endLineDelta == b.endLineDelta;
+}
+
+} // namespace
+
+void TokenDelta::apply(std::vector<PackedToken>& tokens) const {
+    tokens.erase(tokens.begin() + first, tokens.begin() + first + removedCount);
+    tokens.insert(tokens.begin() + first, inserted.begin(), inserted.end());
+    for (size_t i = first + inserted.size(); i < tokens.size(); ++i) {
+        tokens[i].offset = static_cast<uint32_t>(tokens[i].offset + offsetShift);
+        tokens[i].line = static_cast<uint32_t>(tokens[i].line + lineShift);
+    }
+}
+
+IncrementalLexer::IncrementalLexer(std::shared_ptr<const SourceBuffer> source)
+    : source(source), scanner(source, "") {
+}
+
+TokenDelta IncrementalLexer::relex(const std::vector<PackedToken>& oldTokens, const SourceEdit& edit) {
+    TokenDelta delta;
+    scanned = 0;
+    const int64_t shift = static_cast<int64_t>(edit.insertedLength) - static_cast<int64_t>(edit.removedLength);
+    const size_t editEnd = edit.offset + edit.insertedLength;
+
+    // Scanning a token reads up to and including the character that stops it,
+    // at offset + length, so the first token the edit can change is the first
+    // one whose stopping character is not before the edit.
+    auto affected = std::lower_bound(oldTokens.begin(), oldTokens.end(), edit.offset,
+        [](const PackedToken& token, size_t offset) { return token.offset + token.length < offset; });
+    delta.first = static_cast<size_t>(affected - oldTokens.begin());
+
+    // Restart at that token if it starts before the edit, otherwise right
+    // after the last unaffected token.
+    size_t restart = 0;
+    if (affected != oldTokens.end() && affected->offset < edit.offset) {
+        restart = affected->offset;
+    } else if (affected != oldTokens.begin()) {
+        restart = (affected - 1)->offset + (affected - 1)->length;
+    }
+
+    // Line counter at the restart point, counted from the nearest token
+    // before it that the edit left alone. A lone '_' is reported on the
+    // following line, so it is no use as an anchor.
+    int line = 1;
+    size_t countFrom = 0;
+    for (size_t k = std::min(delta.first + 1, oldTokens.size()); k-- > 0;) {
+        const PackedToken& token = oldTokens[k];
+        if (token.offset > restart || token.offset >= edit.offset) continue;
+        if (token.kind == TokenType::INVALID_ID && token.length == 1) continue;
+        line = static_cast<int>(token.line);
+        countFrom = token.offset + 1;
+        break;
+    }
+    const char* base = source->begin();
+    size_t countTo = std::min(restart + 1, source->size());
+    if (countFrom < countTo) {
+        line += static_cast<int>(CharScan::countNewlines(base + countFrom, base + countTo));
+    }
+
+    // Scan until a new token starts where an old token after the edit started.
+    scanner.seek(restart, line);
+    size_t candidate = static_cast<size_t>(std::lower_bound(oldTokens.begin() + delta.first, oldTokens.end(),
+        edit.offset + edit.removedLength,
+        [](const PackedToken& token, size_t offset) { return token.offset < offset; }) - oldTokens.begin());
+    size_t resync = oldTokens.size();
+    for (Token token = scanner.getNextToken(); token.kind != TokenType::END_OF_FILE; token = scanner.getNextToken()) {
+        PackedToken packed = scanner.pack(token);
+        scanned++;
+        if (packed.offset >= editEnd) {
+            int64_t oldOffset = static_cast<int64_t>(packed.offset) - shift;
+            while (candidate < oldTokens.size() && oldTokens[candidate].offset < oldOffset) {
+                candidate++;
+            }
+            if (candidate < oldTokens.size() && oldTokens[candidate].offset == oldOffset) {
+                resync = candidate;
+                delta.lineShift = static_cast<int32_t>(packed.line) - static_cast<int32_t>(oldTokens[candidate].line);
+                break;
+            }
+        }
+        delta.inserted.push_back(packed);
+    }
+    delta.offsetShift = shift;
+
+    // Drop re-lexed tokens that did not change.
+    size_t unchanged = 0;
+    while (unchanged < delta.inserted.size() && delta.first + unchanged < resync &&
+           sameToken(delta.inserted[unchanged], oldTokens[delta.first + unchanged])) {
+        unchanged++;
+    }
+    delta.inserted.erase(delta.inserted.begin(), delta.inserted.begin() + unchanged);
+    delta.first += unchanged;
+    delta.removedCount = resync - delta.first;
+    return delta;
+}
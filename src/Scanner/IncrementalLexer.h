@@ -0,0 +1,87 @@
+/**
+ * @file IncrementalLexer.h
+ * @brief Re-lexes only the part of a buffer affected by an edit.
+ *
+ * Given the tokens of a buffer before an edit and the buffer after it, the
+ * lexer restarts at the last token boundary the edit cannot have influenced
+ * and scans forward until it produces a token at the same place, relative to
+ * the end of the edit, as one of the old tokens. Lexing is deterministic from
+ * a token boundary, so every later old token is still valid once its offset
+ * and line are shifted. The result is a TokenDelta describing the change.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#ifndef INCREMENTALLEXER_H
+#define INCREMENTALLEXER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Scanner.h"
+
+/**
+ * @struct SourceEdit
+ * @brief A byte range of the old buffer replaced by new text.
+ */
+struct SourceEdit {
+    size_t offset;          ///< Offset of the first replaced byte
+    size_t removedLength;   ///< Number of bytes removed from the old buffer
+    size_t insertedLength;  ///< Number of bytes inserted in their place
+};
+
+/**
+ * @struct TokenDelta
+ * @brief The difference between the token arrays of a buffer before and after an edit.
+ *
+ * The old tokens [first, first + removedCount) are replaced by inserted;
+ * every old token after them moves by offsetShift bytes and lineShift lines.
+ */
+struct TokenDelta {
+    size_t first = 0;                   ///< Index of the first replaced old token
+    size_t removedCount = 0;            ///< Number of old tokens replaced
+    std::vector<PackedToken> inserted;  ///< New tokens, positioned in the new buffer
+    int64_t offsetShift = 0;            ///< Offset change of the tokens after the replaced range
+    int32_t lineShift = 0;              ///< Line change of the tokens after the replaced range
+
+    /**
+     * @brief Turns the old token array into the new one.
+     * @param tokens The tokens the delta was computed from.
+     */
+    void apply(std::vector<PackedToken>& tokens) const;
+};
+
+/**
+ * @class IncrementalLexer
+ * @brief Computes token deltas for edits of a buffer.
+ */
+class IncrementalLexer {
+public:
+    /**
+     * @brief Prepares to re-lex the given (already edited) buffer.
+     * @param source The buffer after the edit.
+     */
+    explicit IncrementalLexer(std::shared_ptr<const SourceBuffer> source);
+
+    /**
+     * @brief Re-lexes the region of the buffer affected by an edit.
+     * @param oldTokens All tokens of the buffer before the edit, in source order.
+     * @param edit The edit that turned the old buffer into this lexer's buffer.
+     * @return The delta that turns oldTokens into the tokens of the new buffer.
+     */
+    TokenDelta relex(const std::vector<PackedToken>& oldTokens, const SourceEdit& edit);
+
+    /**
+     * @brief Retrieves how many tokens the last relex() call scanned.
+     */
+    size_t getScannedCount() const { return scanned; }
+
+private:
+    std::shared_ptr<const SourceBuffer> source; ///< Buffer after the edit
+    Scanner scanner;                            ///< Scanner over the new buffer
+    size_t scanned = 0;                         ///< Tokens scanned by the last relex()
+};
+
+#endif // INCREMENTALLEXER_H
@@ -0,0 +1,273 @@
+/**
+ * @file LexerDFA.h
+ * @brief Compile-time transition table for the lexer automaton.
+ *
+ * This is the automaton of docs/lexer_fsa.mermaid, refined so that every
+ * validity rule the hand-written scanner enforces (leading zeros, trailing
+ * fraction zeros, missing exponent digits, letters glued to numbers) is
+ * encoded in the states themselves. Input bytes are first compressed into a
+ * handful of character classes, so the table is STATE_COUNT x CLASS_COUNT
+ * bytes and the scanning loop is a single lookup per character.
+ *
+ * Nested block comments are not regular: the automaton only recognises the
+ * opening "/" "*" and hands the body over to the scanner.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#ifndef LEXERDFA_H
+#define LEXERDFA_H
+
+#include <array>
+#include <cstdint>
+#include "Token.h"
+
+namespace LexerDFA {
+
+/**
+ * @brief Character classes the input bytes are compressed into.
+ */
+enum CharClass : uint8_t {
+    OTHER,       ///< Anything that cannot start or continue a token
+    SPACE,       ///< Whitespace other than newline
+    NEWLINE,     ///< '\n'
+    LETTER,      ///< Letters other than 'e' and 'E'
+    EXP,         ///< 'e' or 'E'
+    ZERO,        ///< '0'
+    NONZERO,     ///< '1' to '9'
+    UNDERSCORE,  ///< '_'
+    DOT,         ///< '.'
+    SIGN,        ///< '+' or '-'
+    EQUAL,       ///< '='
+    LESS,        ///< '<'
+    GREATER,     ///< '>'
+    COLON,       ///< ':'
+    STAR,        ///< '*'
+    SLASH,       ///< '/'
+    PUNCT,       ///< ( ) { } [ ] , ;
+    CLASS_COUNT
+};
+
+/**
+ * @brief States of the automaton. DEAD stops the scanning loop.
+ */
+enum State : uint8_t {
+    DEAD,
+    START,
+    IDENT,          ///< Identifier or reserved word
+    BAD_IDENT,      ///< Identifier starting with '_'
+    INT_ZERO,       ///< "0"
+    INT_DIGITS,     ///< Integer without leading zero
+    INT_BAD,        ///< Integer with a leading zero
+    FRAC_DOT,       ///< Integer part followed by '.'
+    FRAC_ONE,       ///< One fraction digit
+    FRAC_NONZERO,   ///< Several fraction digits, last one non-zero
+    FRAC_ZERO,      ///< Several fraction digits, last one zero
+    FRAC_BAD,       ///< Fraction of an already invalid number
+    EXP_INT,        ///< 'e' after an integer
+    EXP_INT_SIGN,   ///< Sign after 'e' after an integer
+    EXP_INT_ZERO,   ///< Exponent "0" after an integer
+    EXP_INT_DIGITS, ///< Exponent digits after an integer
+    EXP_FLOAT,      ///< 'e' after a float
+    EXP_FLOAT_SIGN, ///< Sign after 'e' after a float
+    EXP_FLOAT_ZERO, ///< Exponent "0" after a float
+    EXP_FLOAT_DIGITS, ///< Exponent digits after a float
+    EXP_BAD,        ///< 'e' after an invalid number
+    EXP_BAD_SIGN,   ///< Sign after 'e' after an invalid number
+    EXP_BAD_DIGITS, ///< Exponent digits of an invalid number
+    NUM_TRAILING,   ///< Letters or underscores glued to a number
+    OP_EQUAL,       ///< "="
+    OP_LESS,        ///< "<"
+    OP_GREATER,     ///< ">"
+    OP_COLON,       ///< ":"
+    OP_DONE,        ///< Complete two-character operator
+    SINGLE,         ///< Complete single-character operator or punctuation
+    OP_SLASH,       ///< "/"
+    INLINE_COMMENT, ///< "//" up to the end of the line
+    BLOCK_COMMENT,  ///< "/*"; the body is scanned by the Scanner
+    INVALID,        ///< Invalid character
+    STATE_COUNT
+};
+
+/**
+ * @brief What the scanner does with the state the loop stopped in.
+ */
+enum Accept : uint8_t {
+    ACCEPT_TYPE,        ///< The token type is acceptTypes[state]
+    ACCEPT_IDENTIFIER,  ///< Lexicon::reservedWordType(lexeme)
+    ACCEPT_SINGLE,      ///< Lexicon::singleCharType(first character)
+    ACCEPT_TWO_CHAR,    ///< Lexicon::twoCharType(first two characters)
+    ACCEPT_BLOCK_COMMENT ///< Hand the comment body over to the scanner
+};
+
+using TransitionTable = std::array<std::array<uint8_t, CLASS_COUNT>, STATE_COUNT>;
+
+/**
+ * @brief Maps every byte to its character class.
+ */
+inline constexpr std::array<uint8_t, 256> charClasses = [] {
+    std::array<uint8_t, 256> classes{};
+    for (int c = 'a'; c <= 'z'; ++c) classes[c] = LETTER;
+    for (int c = 'A'; c <= 'Z'; ++c) classes[c] = LETTER;
+    classes['e'] = classes['E'] = EXP;
+    classes['0'] = ZERO;
+    for (int c = '1'; c <= '9'; ++c) classes[c] = NONZERO;
+    classes[' '] = classes['\t'] = classes['\r'] = classes['\v'] = classes['\f'] = SPACE;
+    classes['\n'] = NEWLINE;
+    classes['_'] = UNDERSCORE;
+    classes['.'] = DOT;
+    classes['+'] = classes['-'] = SIGN;
+    classes['='] = EQUAL;
+    classes['<'] = LESS;
+    classes['>'] = GREATER;
+    classes[':'] = COLON;
+    classes['*'] = STAR;
+    classes['/'] = SLASH;
+    for (char c : {'(', ')', '{', '}', '[', ']', ',', ';'}) classes[static_cast<uint8_t>(c)] = PUNCT;
+    return classes;
+}();
+
+/**
+ * @brief The transition table, indexed by [state][character class].
+ */
+inline constexpr TransitionTable transitions = [] {
+    TransitionTable t{};
+    auto on = [&t](State from, std::initializer_list<CharClass> classes, State to) {
+        for (CharClass c : classes) t[from][c] = to;
+    };
+    const auto identChars = {LETTER, EXP, ZERO, NONZERO, UNDERSCORE};
+    const auto digits = {ZERO, NONZERO};
+    const auto trailing = {LETTER, EXP, UNDERSCORE};
+
+    // Start state
+    on(START, {LETTER, EXP}, IDENT);
+    on(START, {UNDERSCORE}, BAD_IDENT);
+    on(START, {ZERO}, INT_ZERO);
+    on(START, {NONZERO}, INT_DIGITS);
+    on(START, {EQUAL}, OP_EQUAL);
+    on(START, {LESS}, OP_LESS);
+    on(START, {GREATER}, OP_GREATER);
+    on(START, {COLON}, OP_COLON);
+    on(START, {SIGN, STAR, DOT, PUNCT}, SINGLE);
+    on(START, {SLASH}, OP_SLASH);
+    on(START, {OTHER, SPACE, NEWLINE}, INVALID);
+
+    // Identifiers
+    on(IDENT, identChars, IDENT);
+    on(BAD_IDENT, identChars, BAD_IDENT);
+
+    // Integer part
+    on(INT_ZERO, digits, INT_BAD);
+    on(INT_DIGITS, digits, INT_DIGITS);
+    on(INT_BAD, digits, INT_BAD);
+    on(INT_ZERO, {DOT}, FRAC_DOT);
+    on(INT_DIGITS, {DOT}, FRAC_DOT);
+    on(INT_BAD, {DOT}, FRAC_BAD);
+    on(INT_ZERO, {EXP}, EXP_INT);
+    on(INT_DIGITS, {EXP}, EXP_INT);
+    on(INT_BAD, {EXP}, EXP_BAD);
+
+    // Fraction part: more than one digit must not end with a zero
+    on(FRAC_DOT, digits, FRAC_ONE);
+    on(FRAC_ONE, {ZERO}, FRAC_ZERO);
+    on(FRAC_ONE, {NONZERO}, FRAC_NONZERO);
+    on(FRAC_NONZERO, {ZERO}, FRAC_ZERO);
+    on(FRAC_NONZERO, {NONZERO}, FRAC_NONZERO);
+    on(FRAC_ZERO, {ZERO}, FRAC_ZERO);
+    on(FRAC_ZERO, {NONZERO}, FRAC_NONZERO);
+    on(FRAC_BAD, digits, FRAC_BAD);
+    on(FRAC_DOT, {EXP}, EXP_BAD);
+    on(FRAC_ONE, {EXP}, EXP_FLOAT);
+    on(FRAC_NONZERO, {EXP}, EXP_FLOAT);
+    on(FRAC_ZERO, {EXP}, EXP_BAD);
+    on(FRAC_BAD, {EXP}, EXP_BAD);
+
+    // Exponent part: optional sign, then digits without a leading zero
+    on(EXP_INT, {SIGN}, EXP_INT_SIGN);
+    on(EXP_FLOAT, {SIGN}, EXP_FLOAT_SIGN);
+    on(EXP_BAD, {SIGN}, EXP_BAD_SIGN);
+    on(EXP_INT, {ZERO}, EXP_INT_ZERO);
+    on(EXP_INT_SIGN, {ZERO}, EXP_INT_ZERO);
+    on(EXP_INT, {NONZERO}, EXP_INT_DIGITS);
+    on(EXP_INT_SIGN, {NONZERO}, EXP_INT_DIGITS);
+    on(EXP_INT_DIGITS, digits, EXP_INT_DIGITS);
+    on(EXP_INT_ZERO, digits, EXP_BAD_DIGITS);
+    on(EXP_FLOAT, {ZERO}, EXP_FLOAT_ZERO);
+    on(EXP_FLOAT_SIGN, {ZERO}, EXP_FLOAT_ZERO);
+    on(EXP_FLOAT, {NONZERO}, EXP_FLOAT_DIGITS);
+    on(EXP_FLOAT_SIGN, {NONZERO}, EXP_FLOAT_DIGITS);
+    on(EXP_FLOAT_DIGITS, digits, EXP_FLOAT_DIGITS);
+    on(EXP_FLOAT_ZERO, digits, EXP_BAD_DIGITS);
+    on(EXP_BAD, digits, EXP_BAD_DIGITS);
+    on(EXP_BAD_SIGN, digits, EXP_BAD_DIGITS);
+    on(EXP_BAD_DIGITS, digits, EXP_BAD_DIGITS);
+
+    // Letters or underscores glued to any number make it invalid
+    for (State s : {INT_ZERO, INT_DIGITS, INT_BAD, FRAC_DOT, FRAC_ONE, FRAC_NONZERO,
+                    FRAC_ZERO, FRAC_BAD}) {
+        on(s, {LETTER, UNDERSCORE}, NUM_TRAILING);
+    }
+    for (State s : {EXP_INT, EXP_INT_SIGN, EXP_INT_ZERO, EXP_INT_DIGITS, EXP_FLOAT,
+                    EXP_FLOAT_SIGN, EXP_FLOAT_ZERO, EXP_FLOAT_DIGITS, EXP_BAD,
+                    EXP_BAD_SIGN, EXP_BAD_DIGITS}) {
+        on(s, trailing, NUM_TRAILING);
+    }
+    on(NUM_TRAILING, identChars, NUM_TRAILING);
+
+    // Operators
+    on(OP_EQUAL, {EQUAL, GREATER}, OP_DONE);
+    on(OP_LESS, {GREATER, EQUAL}, OP_DONE);
+    on(OP_GREATER, {EQUAL}, OP_DONE);
+    on(OP_COLON, {EQUAL}, OP_DONE);
+
+    // Comments
+    on(OP_SLASH, {SLASH}, INLINE_COMMENT);
+    on(OP_SLASH, {STAR}, BLOCK_COMMENT);
+    for (int c = 0; c < CLASS_COUNT; ++c) {
+        if (c != NEWLINE) t[INLINE_COMMENT][c] = INLINE_COMMENT;
+    }
+    return t;
+}();
+
+/**
+ * @brief Action taken for the state the scanning loop stopped in.
+ */
+inline constexpr std::array<Accept, STATE_COUNT> acceptActions = [] {
+    std::array<Accept, STATE_COUNT> actions{};
+    for (auto& action : actions) action = ACCEPT_TYPE;
+    actions[IDENT] = ACCEPT_IDENTIFIER;
+    actions[SINGLE] = ACCEPT_SINGLE;
+    actions[OP_LESS] = ACCEPT_SINGLE;
+    actions[OP_GREATER] = ACCEPT_SINGLE;
+    actions[OP_COLON] = ACCEPT_SINGLE;
+    actions[OP_DONE] = ACCEPT_TWO_CHAR;
+    actions[BLOCK_COMMENT] = ACCEPT_BLOCK_COMMENT;
+    return actions;
+}();
+
+/**
+ * @brief Token type produced by ACCEPT_TYPE states.
+ */
+inline constexpr std::array<TokenType, STATE_COUNT> acceptTypes = [] {
+    std::array<TokenType, STATE_COUNT> types{};
+    for (auto& type : types) type = TokenType::INVALID_LIT;
+    types[BAD_IDENT] = TokenType::INVALID_ID;
+    types[INT_ZERO] = TokenType::INTLIT;
+    types[INT_DIGITS] = TokenType::INTLIT;
+    types[EXP_INT_ZERO] = TokenType::INTLIT;
+    types[EXP_INT_DIGITS] = TokenType::INTLIT;
+    types[FRAC_ONE] = TokenType::FLOATLIT;
+    types[FRAC_NONZERO] = TokenType::FLOATLIT;
+    types[EXP_FLOAT_ZERO] = TokenType::FLOATLIT;
+    types[EXP_FLOAT_DIGITS] = TokenType::FLOATLIT;
+    types[OP_EQUAL] = TokenType::INVALID_CHAR;
+    types[INVALID] = TokenType::INVALID_CHAR;
+    types[OP_SLASH] = TokenType::DIV;
+    types[INLINE_COMMENT] = TokenType::INLINE_COMMENT;
+    return types;
+}();
+
+} // namespace LexerDFA
+
+#endif // LEXERDFA_H
@@ -0,0 +1,145 @@
+/**
+ * @file Lexicon.h
+ * @brief Compile-time classification of reserved words, operators and punctuation.
+ *
+ * The fixed lexicon of the language is resolved without building strings or
+ * touching a hash map: reserved words go through a perfect hash over the
+ * first two characters and the length, confirmed by a single comparison, and
+ * operators and punctuation are looked up by character.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#ifndef LEXICON_H
+#define LEXICON_H
+
+#include "Token.h"
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace Lexicon {
+
+/**
+ * @struct ReservedWord
+ * @brief A reserved word and its token type.
+ */
+struct ReservedWord {
+    std::string_view text;
+    TokenType type;
+};
+
+/**
+ * @brief The reserved words of the language.
+ */
+inline constexpr std::array<ReservedWord, 23> reservedWords = {{
+    {"int", TokenType::INT}, {"float", TokenType::FLOAT}, {"void", TokenType::VOID},
+    {"class", TokenType::CLASS}, {"self", TokenType::SELF}, {"isa", TokenType::ISA},
+    {"while", TokenType::WHILE}, {"if", TokenType::IF}, {"then", TokenType::THEN},
+    {"else", TokenType::ELSE}, {"read", TokenType::READ}, {"write", TokenType::WRITE},
+    {"return", TokenType::RETURN}, {"local", TokenType::LOCAL},
+    {"constructor", TokenType::CONSTRUCTOR}, {"attribute", TokenType::ATTRIBUTE},
+    {"function", TokenType::FUNCTION}, {"public", TokenType::PUBLIC},
+    {"private", TokenType::PRIVATE}, {"implementation", TokenType::IMPLEMENTATION},
+    {"or", TokenType::OR}, {"and", TokenType::AND}, {"not", TokenType::NOT}
+}};
+
+inline constexpr size_t RESERVED_WORD_SLOTS = 64;
+
+/**
+ * @brief Hashes a word of at least two characters into a reserved word slot.
+ *
+ * The multipliers were chosen so that every reserved word lands in its own
+ * slot; the static_assert below keeps that true if the list changes.
+ */
+constexpr size_t reservedWordHash(std::string_view word) {
+    return (static_cast<unsigned char>(word[0]) * 3u +
+            static_cast<unsigned char>(word[1]) * 9u +
+            word.size()) & (RESERVED_WORD_SLOTS - 1);
+}
+
+/**
+ * @brief Reserved word slots indexed by reservedWordHash(); empty slots hold ID.
+ */
+inline constexpr std::array<ReservedWord, RESERVED_WORD_SLOTS> reservedWordSlots = [] {
+    std::array<ReservedWord, RESERVED_WORD_SLOTS> slots{};
+    for (auto& slot : slots) slot = {"", TokenType::ID};
+    for (const auto& word : reservedWords) slots[reservedWordHash(word.text)] = word;
+    return slots;
+}();
+
+constexpr bool reservedWordHashIsPerfect() {
+    for (const auto& word : reservedWords) {
+        if (word.text.size() < 2 || reservedWordSlots[reservedWordHash(word.text)].text != word.text) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(reservedWordHashIsPerfect(), "reserved word hash has a collision");
+
+/**
+ * @brief Classifies a well-formed identifier.
+ * @param lexeme The identifier text.
+ * @return The reserved word's token type, or TokenType::ID.
+ */
+constexpr TokenType reservedWordType(std::string_view lexeme) {
+    if (lexeme.size() < 2) return TokenType::ID;
+    const ReservedWord& slot = reservedWordSlots[reservedWordHash(lexeme)];
+    return slot.text == lexeme ? slot.type : TokenType::ID;
+}
+
+/**
+ * @brief Token types of the single-character operators and punctuation.
+ */
+inline constexpr std::array<TokenType, 256> singleCharTypes = [] {
+    std::array<TokenType, 256> types{};
+    for (auto& type : types) type = TokenType::INVALID_CHAR;
+    types['+'] = TokenType::PLUS;   types['-'] = TokenType::MINUS;
+    types['*'] = TokenType::MULT;   types['/'] = TokenType::DIV;
+    types['('] = TokenType::LPAR;   types[')'] = TokenType::RPAR;
+    types['{'] = TokenType::LCURBR; types['}'] = TokenType::RCURBR;
+    types['['] = TokenType::LSQBR;  types[']'] = TokenType::RSQBR;
+    types[','] = TokenType::COMMA;  types['.'] = TokenType::DOT;
+    types[':'] = TokenType::COLON;  types[';'] = TokenType::SEMI;
+    types['<'] = TokenType::LT;     types['>'] = TokenType::GT;
+    return types;
+}();
+
+/**
+ * @brief Classifies a single character as an operator or punctuation.
+ * @return The token type, or TokenType::INVALID_CHAR.
+ */
+constexpr TokenType singleCharType(char c) {
+    return singleCharTypes[static_cast<unsigned char>(c)];
+}
+
+/**
+ * @brief Classifies a pair of characters as a two-character operator.
+ * @return The operator's token type, or TokenType::COUNT if the pair is not one.
+ */
+constexpr TokenType twoCharType(char first, char second) {
+    switch (first) {
+        case '=':
+            if (second == '=') return TokenType::EQ;
+            if (second == '>') return TokenType::ARROW;
+            break;
+        case '<':
+            if (second == '>') return TokenType::NEQ;
+            if (second == '=') return TokenType::LEQ;
+            break;
+        case '>':
+            if (second == '=') return TokenType::GEQ;
+            break;
+        case ':':
+            if (second == '=') return TokenType::ASSIGN;
+            break;
+    }
+    return TokenType::COUNT;
+}
+
+} // namespace Lexicon
+
+#endif // LEXICON_H
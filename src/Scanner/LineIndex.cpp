@@ -0,0 +1,54 @@
+/**
+ * @file LineIndex.cpp
+ * @brief Implementation of the line start index.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#include "LineIndex.h"
+#include "CharScan.h"
+#include <algorithm>
+
+LineIndex::LineIndex(const SourceBuffer& source) : text(source.text()) {
+    const char* base = source.begin();
+    const char* end = source.end();
+    lineStarts.reserve(CharScan::countNewlines(base, end) + 1);
+    lineStarts.push_back(0);
+    for (const char* p = CharScan::findNewline(base, end); p < end; p = CharScan::findNewline(p + 1, end)) {
+        lineStarts.push_back(static_cast<uint32_t>(p + 1 - base));
+    }
+}
+
+SourcePosition LineIndex::locate(size_t offset) const {
+    auto next = std::upper_bound(lineStarts.begin(), lineStarts.end(), static_cast<uint32_t>(offset));
+    size_t line = static_cast<size_t>(next - lineStarts.begin());
+    return {static_cast<int>(line), static_cast<int>(offset - lineStarts[line - 1]) + 1};
+}
+
+std::string_view LineIndex::getLineText(int line) const {
+    if (line < 1 || line > getLineCount()) return {};
+    size_t begin = lineStarts[line - 1];
+    size_t end = line < getLineCount() ? lineStarts[line] - 1 : text.size();
+    if (end > begin && text[end - 1] == '\r') end--;
+    return text.substr(begin, end - begin);
+}
+
+std::string LineIndex::formatSnippet(int line, int column) const {
+    if (line < 1 || line > getLineCount()) return "";
+    std::string number = std::to_string(line);
+    std::string_view lineText = getLineText(line);
+
+    std::string snippet = " " + number + " | ";
+    snippet.append(lineText);
+    snippet += '\n';
+    if (column > 0) {
+        snippet += " " + std::string(number.size(), ' ') + " | ";
+        // Keep tabs so the caret lines up with the text above it.
+        for (int i = 0; i + 1 < column && i < static_cast<int>(lineText.size()); ++i) {
+            snippet += lineText[i] == '\t' ? '\t' : ' ';
+        }
+        snippet += "^\n";
+    }
+    return snippet;
+}
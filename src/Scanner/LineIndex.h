@@ -0,0 +1,85 @@
+/**
+ * @file LineIndex.h
+ * @brief Table of line start offsets for position lookups and diagnostics.
+ *
+ * The index stores the byte offset at which every line of a source buffer
+ * starts, found with one vectorised newline search over the buffer. Mapping an
+ * offset to a line and column is a binary search; slicing the text of a line
+ * is two table reads. Later phases only carry line numbers, so the index lets
+ * them quote the offending source line without reading the file again.
+ *
+ * Line numbers agree with the ones the Scanner assigns to tokens.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#ifndef LINEINDEX_H
+#define LINEINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "SourceBuffer.h"
+
+/**
+ * @struct SourcePosition
+ * @brief A 1-based line and column in a source buffer.
+ */
+struct SourcePosition {
+    int line;    ///< Line number, starting at 1
+    int column;  ///< Column number (byte within the line), starting at 1
+};
+
+/**
+ * @class LineIndex
+ * @brief Line start offsets of one source buffer.
+ */
+class LineIndex {
+public:
+    /**
+     * @brief Builds the index of the given buffer.
+     * @param source The buffer to index; it must outlive the index.
+     */
+    explicit LineIndex(const SourceBuffer& source);
+
+    /**
+     * @brief Retrieves the number of lines in the buffer.
+     * @return The line count; an empty buffer has one empty line.
+     */
+    int getLineCount() const { return static_cast<int>(lineStarts.size()); }
+
+    /**
+     * @brief Finds the line and column of a byte offset.
+     * @param offset Byte offset in [0, size] of the buffer.
+     * @return The position of that byte.
+     */
+    SourcePosition locate(size_t offset) const;
+
+    /**
+     * @brief Retrieves the text of a line.
+     * @param line The line number.
+     * @return The line without its line terminator, or an empty view if the line does not exist.
+     */
+    std::string_view getLineText(int line) const;
+
+    /**
+     * @brief Formats a line for an error message.
+     *
+     * The line is printed after a line number gutter; if a column is given, a
+     * second line puts a caret under it.
+     *
+     * @param line The line number.
+     * @param column The column to point at, or 0 for none.
+     * @return The formatted snippet ending with a newline, or an empty string if the line does not exist.
+     */
+    std::string formatSnippet(int line, int column = 0) const;
+
+private:
+    std::string_view text;            ///< Text of the indexed buffer
+    std::vector<uint32_t> lineStarts; ///< Offset of the first byte of every line
+};
+
+#endif // LINEINDEX_H
@@ -0,0 +1,126 @@
+/**
+ * @file ParallelLexer.cpp
+ * @brief Implementation of chunked, multi-threaded lexing.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#include "ParallelLexer.h"
+#include "CharScan.h"
+#include <algorithm>
+#include <thread>
+
+ParallelLexer::ParallelLexer(std::shared_ptr<const SourceBuffer> source, size_t chunkCount)
+    : source(std::move(source)) {
+    const char* base = this->source->begin();
+    size_t size = this->source->size();
+    chunkCount = std::max<size_t>(chunkCount, 1);
+
+    // Split after the first newline at or past each evenly spaced target offset.
+    size_t begin = 0;
+    for (size_t k = 1; k < chunkCount; ++k) {
+        size_t target = std::max(size * k / chunkCount, begin);
+        const char* newline = CharScan::findNewline(base + target, base + size);
+        size_t boundary = static_cast<size_t>(newline - base) + 1;
+        if (boundary >= size) break;
+        if (boundary <= begin) continue;
+        chunks.push_back({begin, boundary, 1, 0, {}});
+        begin = boundary;
+    }
+    chunks.push_back({begin, size, 1, 0, {}});
+}
+
+size_t ParallelLexer::chunkCountFor(size_t size, unsigned threads) {
+    if (threads <= 1) return 1;
+    return std::max<size_t>(1, std::min<size_t>(threads, size / MIN_CHUNK_SIZE));
+}
+
+void ParallelLexer::lexChunk(Chunk& chunk) const {
+    const char* begin = source->begin() + chunk.begin;
+    const char* end = source->begin() + chunk.end;
+    chunk.newlines = static_cast<int>(CharScan::countNewlines(begin, end));
+
+    Scanner scanner(std::make_shared<const SourceBuffer>(begin, chunk.end - chunk.begin), "");
+    for (Token token = scanner.getNextToken(); token.kind != TokenType::END_OF_FILE; token = scanner.getNextToken()) {
+        PackedToken packed = scanner.pack(token);
+        packed.offset += static_cast<uint32_t>(chunk.begin);
+        chunk.tokens.push_back(packed);
+    }
+}
+
+std::vector<PackedToken> ParallelLexer::run() {
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < chunks.size(); ++i) {
+        workers.emplace_back([this, i] { lexChunk(chunks[i]); });
+    }
+    lexChunk(chunks[0]);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (size_t i = 1; i < chunks.size(); ++i) {
+        chunks[i].firstLine = chunks[i - 1].firstLine + chunks[i - 1].newlines;
+    }
+    return stitch();
+}
+
+size_t ParallelLexer::chunkContaining(size_t offset) const {
+    auto it = std::upper_bound(chunks.begin(), chunks.end(), offset,
+                               [](size_t value, const Chunk& chunk) { return value < chunk.begin; });
+    return static_cast<size_t>(it - chunks.begin()) - 1;
+}
+
+std::vector<PackedToken> ParallelLexer::stitch() {
+    std::vector<PackedToken> result;
+    size_t total = 0;
+    for (const auto& chunk : chunks) total += chunk.tokens.size();
+    result.reserve(total);
+
+    Scanner scanner(source, "");
+    size_t current = 0;
+    size_t index = 0;
+    while (current < chunks.size()) {
+        const Chunk& chunk = chunks[current];
+        if (index == chunk.tokens.size()) {
+            current++;
+            index = 0;
+            continue;
+        }
+
+        PackedToken token = chunk.tokens[index++];
+        token.line += chunk.firstLine - 1;
+
+        // A chunk ends right after a newline, which only an unterminated block
+        // comment can swallow. Every other token is final.
+        bool openComment = current + 1 < chunks.size() && token.offset + token.length == chunk.end;
+        if (!openComment) {
+            result.push_back(token);
+            continue;
+        }
+
+        // Re-lex from the comment until a token starts where a later chunk's
+        // speculative pass also started one; from there on the two agree.
+        scanner.seek(token.offset, static_cast<int>(token.line));
+        size_t origin = current;
+        current = chunks.size();
+        for (Token next = scanner.getNextToken(); next.kind != TokenType::END_OF_FILE;
+             next = scanner.getNextToken()) {
+            PackedToken packed = scanner.pack(next);
+            size_t owner = chunkContaining(packed.offset);
+            if (owner > origin) {
+                const auto& tokens = chunks[owner].tokens;
+                auto match = std::lower_bound(tokens.begin(), tokens.end(), packed.offset,
+                                              [](const PackedToken& t, uint32_t offset) { return t.offset < offset; });
+                if (match != tokens.end() && match->offset == packed.offset) {
+                    current = owner;
+                    index = static_cast<size_t>(match - tokens.begin());
+                    break;
+                }
+            }
+            result.push_back(packed);
+            relexed++;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file ParallelLexer.h
+ * @brief Lexes a large source buffer in chunks on worker threads.
+ *
+ * The buffer is split into chunks that start at the beginning of a line. Only
+ * block comments can span lines, so every chunk is lexed speculatively as if
+ * it started outside of a comment. A sequential fix-up pass then stitches the
+ * chunks together: token lines are shifted by the number of lines before the
+ * chunk, and when a chunk ends inside an open block comment the scanner
+ * re-lexes from the start of that comment until it lands on a token boundary
+ * that the speculative pass also found, from where the speculative tokens are
+ * used again. The result is exactly the token sequence of a sequential scan.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#ifndef PARALLELLEXER_H
+#define PARALLELLEXER_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "Scanner.h"
+
+/**
+ * @class ParallelLexer
+ * @brief Chunked, multi-threaded equivalent of scanning a whole buffer.
+ */
+class ParallelLexer {
+public:
+    static constexpr size_t MIN_CHUNK_SIZE = 256 * 1024; ///< Smallest chunk worth a thread (bytes)
+
+    /**
+     * @brief Prepares to lex the given buffer in the given number of chunks.
+     * @param source The buffer to lex.
+     * @param chunkCount Requested number of chunks (and threads). Fewer are used
+     *                   if the buffer does not have enough lines.
+     */
+    ParallelLexer(std::shared_ptr<const SourceBuffer> source, size_t chunkCount);
+
+    /**
+     * @brief Lexes the buffer.
+     * @return All tokens of the buffer in source order, as a sequential scan returns them.
+     */
+    std::vector<PackedToken> run();
+
+    /**
+     * @brief Retrieves the number of chunks the buffer was split into.
+     */
+    size_t getChunkCount() const { return chunks.size(); }
+
+    /**
+     * @brief Retrieves how many tokens the fix-up pass had to re-lex.
+     */
+    size_t getRelexedCount() const { return relexed; }
+
+    /**
+     * @brief Picks a chunk count for a buffer size and thread budget.
+     * @return The number of chunks, at least 1, so that no chunk is smaller than MIN_CHUNK_SIZE.
+     */
+    static size_t chunkCountFor(size_t size, unsigned threads);
+
+private:
+    /**
+     * @struct Chunk
+     * @brief One line-aligned slice of the buffer and its speculative tokens.
+     */
+    struct Chunk {
+        size_t begin;                     ///< Offset of the first byte
+        size_t end;                       ///< Offset one past the last byte
+        int firstLine;                    ///< Line number of the first byte
+        int newlines;                     ///< Number of newlines in the chunk
+        std::vector<PackedToken> tokens;  ///< Tokens, with chunk-relative line numbers
+    };
+
+    std::shared_ptr<const SourceBuffer> source; ///< Buffer being lexed
+    std::vector<Chunk> chunks;                  ///< Line-aligned chunks in source order
+    size_t relexed = 0;                         ///< Tokens produced by the fix-up pass
+
+    /**
+     * @brief Lexes one chunk as if it started outside of any comment.
+     */
+    void lexChunk(Chunk& chunk) const;
+
+    /**
+     * @brief Finds the chunk that contains the given offset.
+     */
+    size_t chunkContaining(size_t offset) const;
+
+    /**
+     * @brief Joins the speculative chunk tokens into the sequential token sequence.
+     */
+    std::vector<PackedToken> stitch();
+};
+
+#endif // PARALLELLEXER_H
@@ -11,88 +11,70 @@
  */
 
 #include "Scanner.h"
+#include "LexerDFA.h"
+#include "Lexicon.h"
+#include "CharScan.h"
+#include "TokenStream.h"
+#include "TokenWriter.h"
+#include "ParallelLexer.h"
 #include <iostream>
 #include <sstream>
 #include <cctype>
-
-/**
- * @brief Initialize static members with proper token names for operators.
- */
-const std::unordered_map<std::string, std::string> Scanner::operators = {
-    {"==", "eq"}, {"<>", "neq"}, {"<", "lt"}, {">", "gt"},
-    {"<=", "leq"}, {">=", "geq"}, {"+", "plus"}, {"-", "minus"},
-    {"*", "mult"}, {"/", "div"}, {":=", "assign"}, {"=>", "arrow"}
-};
-
-/**
- * @brief Initialize static members with punctuation token names.
- */
-const std::unordered_map<std::string, std::string> Scanner::punctuation = {
-    {"(", "lpar"}, {")", "rpar"}, {"{", "lcurbr"}, {"}", "rcurbr"},
-    {"[", "lsqbr"}, {"]", "rsqbr"}, {",", "comma"}, {".", "dot"},
-    {":", "colon"}, {";", "semi"}
-};
-
-/**
- * @brief Initialize static members with reserved words token names.
- */
-const std::unordered_map<std::string, std::string> Scanner::reservedWords = {
-    {"int", "int"}, {"float", "float"}, {"void", "void"}, {"class", "class"},
-    {"self", "self"}, {"isa", "isa"}, {"while", "while"}, {"if", "if"},
-    {"then", "then"}, {"else", "else"}, {"read", "read"}, {"write", "write"},
-    {"return", "return"}, {"local", "local"}, {"constructor", "constructor"},
-    {"attribute", "attribute"}, {"function", "function"}, {"public", "public"},
-    {"private", "private"}, {"implementation", "implementation"},
-    {"or", "or"}, {"and", "and"}, {"not", "not"}
-};
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
 
 Scanner::Scanner(const std::string& in) : Scanner(in,""){};
 
 Scanner::Scanner(const std::string& in, const std::string& out) : 
-    filename(in), currentLine(1), currentColumn(0) {
-    input.open(filename);
-    if (!input.is_open()) {
-        throw std::runtime_error("Unable to open file " + filename);
+    Scanner(std::make_shared<const SourceBuffer>(in),
+            out == "" ? in.substr(0, in.size()-4) : out) {
+}
+
+Scanner::Scanner(std::shared_ptr<const SourceBuffer> source, const std::string& out) :
+    source(std::move(source)), filename(this->source->getPath()), outputBase(out), currentLine(1), currentColumn(0) {
+    cursor = this->source->begin();
+    end = this->source->end();
+    if (!atEnd() && *cursor == '\n') {
+        currentLine++;
+    } else {
+        currentColumn++;
     }
-    tokenOutput.open((out == "" ? filename.substr(0, filename.size()-4) : out) + ".outlextokens");
-    errorOutput.open((out == "" ? filename.substr(0, filename.size()-4) : out) + ".outlexerrors");
-    getNextChar();
+}
+
+Scanner::Scanner(const char* data, size_t size, TokenSink* output) :
+    Scanner(std::make_shared<const SourceBuffer>(data, size), "") {
+    this->output = output;
+}
+
+Scanner Scanner::fromText(std::string text, TokenSink* output) {
+    Scanner scanner(SourceBuffer::fromText(std::move(text)), "");
+    scanner.output = output;
+    return scanner;
 }
 
 Scanner::Scanner(const Scanner& other) : 
+    source(other.source),
+    cursor(other.cursor),
+    end(other.end),
     filename(other.filename),
+    outputBase(other.outputBase),
     currentLine(other.currentLine),
     currentColumn(other.currentColumn),
-    currentChar(other.currentChar),
-    currentLineText(other.currentLineText),
-    tokens(other.tokens)
+    lineIndex(other.lineIndex),
+    useTransitionTable(other.useTransitionTable),
+    interner(other.interner),
+    output(other.output)
 {
-    // Reopen the input file at the same position
-    if (!other.filename.empty()) {
-        input.open(filename);
-        
-        // If the original file was successfully opened, set position
-        if (other.input.is_open() && input.is_open()) {
-            // Get the current position in the original stream
-            std::streampos inputPos = const_cast<std::ifstream&>(other.input).tellg();
-            
-            // Set the same position in the new stream
-            if (inputPos >= 0) {
-                input.seekg(inputPos);
-            }
-        }
-    }
-}
-
-Scanner::~Scanner() {
-    if (input.is_open()) input.close();
-    if (tokenOutput.is_open()) tokenOutput.close();
-    if (errorOutput.is_open()) errorOutput.close();
+    // The source buffer is shared, so the copy resumes at the same position.
 }
 
 void Scanner::getNextChar() {
-    currentChar = input.get();
-    if (currentChar == '\n') {
+    if (atEnd()) return;
+    ++cursor;
+    if (!atEnd() && *cursor == '\n') {
         currentLine++;
         currentColumn = 0;
     } else {
@@ -100,74 +82,79 @@ void Scanner::getNextChar() {
     }
 }
 
+void Scanner::advanceTo(const char* target) {
+    if (target <= cursor) return;
+    // The line counter moves when the cursor lands on a newline, so the
+    // newlines that count are those in (cursor, target].
+    const char* last = target < end ? target + 1 : end;
+    size_t newlines = CharScan::countNewlines(cursor + 1, last);
+    if (newlines == 0) {
+        currentColumn += static_cast<int>(target - cursor);
+    } else {
+        currentLine += static_cast<int>(newlines);
+        const char* lineStart = last - 1;
+        while (*lineStart != '\n') --lineStart;
+        currentColumn = static_cast<int>(target - lineStart);
+    }
+    cursor = target;
+}
+
 /**
  * @brief Skip whitespace characters in the input stream.
  */
 void Scanner::skipWhitespace() {
-    while (isspace(currentChar) && !input.eof()) {
-        getNextChar();
-    }
+    if (atEnd() || !isspace(static_cast<unsigned char>(*cursor))) return;
+    advanceTo(CharScan::skipWhitespace(cursor + 1, end));
 }
 
 /**
  * @brief Scan and return a comment token.
  * 
  * @param endLine Reference to store the end line of the comment.
- * @return std::string The scanned comment.
+ * @return std::string_view The scanned comment, as it appears in the source.
  */
-std::string Scanner::scanComment(int& endLine) {
-    std::string comment;
-    comment += '/';
+std::string_view Scanner::scanComment(int& endLine) {
+    const char* start = cursor;
     
     getNextChar();
-    if (currentChar == '/') {  // Inline comment
-        do {
-            comment += currentChar;
-            getNextChar();
-        } while (!input.eof() && currentChar != '\n');
+    if (*cursor == '/') {  // Inline comment
+        advanceTo(CharScan::findNewline(cursor + 1, end));
         endLine = currentLine-1;
-        return comment;
+        return std::string_view(start, cursor - start);
     } 
-    else if (currentChar == '*') {  // Block comment
-        comment += '*';
+    else if (*cursor == '*') {  // Block comment
         getNextChar();
-        int nestingLevel = 1;
-        while (nestingLevel > 0 && !input.eof()) {
-            if (currentChar == '/') {
-                char nextChar = input.peek();
-                if (nextChar == '*') {
-                    nestingLevel++;
-                    comment += currentChar;
-                    getNextChar(); // Consume '*'
-                    comment += '*';
-                    getNextChar();
-                } else {
-                    comment += currentChar;
-                    getNextChar();
-                }
-            } else if (currentChar == '*') {
-                comment += currentChar;
-                getNextChar();
-                if (currentChar == '/') {
-                    nestingLevel--;
-                    comment += currentChar;
-                    getNextChar(); // Consume '/'
-                    if (nestingLevel == 0) break;
-                }
-            } else {
-                if (currentChar == '\n') {
-                    comment += "\\n";
-                } else {
-                    comment += currentChar;
-                }
-                getNextChar();
-            }
-        }
+        scanBlockCommentBody();
         endLine = currentLine-1;
-        return comment;
+        return std::string_view(start, cursor - start);
     }
     endLine = currentLine-1;
-    return comment;
+    return std::string_view(start, cursor - start);
+}
+
+/**
+ * @brief Consume the body of a block comment, up to and including the
+ * closing delimiter that matches the already consumed opening one.
+ */
+void Scanner::scanBlockCommentBody() {
+    // Only '*' and '/' can open or close a comment, so everything in between
+    // is skipped in bulk and the newlines are counted once at the end.
+    const char* p = cursor;
+    int nestingLevel = 1;
+    while (nestingLevel > 0) {
+        p = CharScan::findCommentDelimiter(p, end);
+        if (p == end) break;
+        if (*p++ == '/') {
+            if (p < end && *p == '*') {
+                nestingLevel++;
+                p++;
+            }
+        } else if (p < end && *p == '/') {
+            nestingLevel--;
+            p++;
+        }
+    }
+    advanceTo(p);
 }
 
 /**
@@ -209,24 +196,17 @@ bool Scanner::isNonZeroDigit(char c) const {
  * @return Token The scanned token.
  */
 Token Scanner::scanIdentifierOrKeyword() {
-    std::string lexeme;
+    const char* start = cursor;
     int startLine = currentLine;
     
-    while ((isLetter(currentChar) || isDigit(currentChar) || currentChar == '_') && !input.eof()) {
-        lexeme += currentChar;
-        getNextChar();
-    }
-    
-    auto it = reservedWords.find(lexeme);
-    if (it != reservedWords.end()) {
-        return {it->second, lexeme, startLine, startLine};
-    }
+    advanceTo(CharScan::skipIdentifierChars(cursor, end));
+    std::string_view lexeme(start, cursor - start);
     
     if (isLetter(lexeme[0])) {
-        return {"id", lexeme, startLine, startLine};
+        return {Lexicon::reservedWordType(lexeme), lexeme, startLine, startLine};
     }
     
-    return {"invalidid", lexeme, startLine, startLine};
+    return {TokenType::INVALID_ID, lexeme, startLine, startLine};
 }
 
 /**
@@ -235,73 +215,70 @@ Token Scanner::scanIdentifierOrKeyword() {
  * @return Token The scanned token.
  */
 Token Scanner::scanNumber() {
-    std::string lexeme;
+    const char* start = cursor;
     int startLine = currentLine;
     bool isFloat = false;
     bool isExponent = false;
-    std::string integerPart;
-    std::string fractionPart;
-    std::string exponentDigits;
+    std::string_view integerPart;
+    std::string_view fractionPart;
+    std::string_view exponentDigits;
     
     // Integer part
-    while (isDigit(currentChar) && !input.eof()) {
-        integerPart += currentChar;
-        lexeme += currentChar;
+    const char* partStart = cursor;
+    while (!atEnd() && isDigit(*cursor)) {
         getNextChar();
     }
+    integerPart = std::string_view(partStart, cursor - partStart);
     
     // Fraction part
-    if (currentChar == '.') {
+    if (!atEnd() && *cursor == '.') {
         isFloat = true;
-        lexeme += currentChar;
         getNextChar();
         
-        while (isDigit(currentChar) && !input.eof()) {
-            fractionPart += currentChar;
-            lexeme += currentChar;
+        partStart = cursor;
+        while (!atEnd() && isDigit(*cursor)) {
             getNextChar();
         }
-        
+        fractionPart = std::string_view(partStart, cursor - partStart);
     }
     
     // Exponent part
-    if (currentChar == 'e' || currentChar == 'E') {
+    if (!atEnd() && (*cursor == 'e' || *cursor == 'E')) {
         isExponent = true;
-        lexeme += currentChar;
         getNextChar();
         
-        if (currentChar == '+' || currentChar == '-') {
-            lexeme += currentChar;
+        if (!atEnd() && (*cursor == '+' || *cursor == '-')) {
             getNextChar();
         }
         
-        while (isDigit(currentChar) && !input.eof()) {
-            exponentDigits += currentChar;
-            lexeme += currentChar;
+        partStart = cursor;
+        while (!atEnd() && isDigit(*cursor)) {
             getNextChar();
         }
+        exponentDigits = std::string_view(partStart, cursor - partStart);
     }
     
     // Check for trailing letters/underscores
-    if (isLetter(currentChar) || currentChar == '_') {
-        while (isLetter(currentChar) || isDigit(currentChar) || currentChar == '_') {
-            lexeme += currentChar;
+    if (!atEnd() && (isLetter(*cursor) || *cursor == '_')) {
+        while (!atEnd() && (isLetter(*cursor) || isDigit(*cursor) || *cursor == '_')) {
             getNextChar();
         }
-        return {"invalidlit", lexeme, startLine, startLine};
+        return {TokenType::INVALID_LIT, std::string_view(start, cursor - start), startLine, startLine};
     }
 
+    std::string_view lexeme(start, cursor - start);
+
     // Check for invalid float or exponent without digits
     if ((isFloat && fractionPart.empty()) || (isExponent && exponentDigits.empty())) {
-        return {"invalidlit", lexeme, startLine, startLine};
+        return {TokenType::INVALID_LIT, lexeme, startLine, startLine};
     }
 
     // Check for invalid number formats
     if ((integerPart.size() > 1 && integerPart[0] == '0' ) || (exponentDigits.size() > 1 && exponentDigits[0]=='0') || (fractionPart.size() > 1 && fractionPart[fractionPart.size() - 1] == '0')) {
-        return {"invalidlit", lexeme, startLine, startLine};
+        return {TokenType::INVALID_LIT, lexeme, startLine, startLine};
     }
     
-    return {isFloat ? "floatlit" : "intlit", lexeme, startLine, startLine};
+    return {isFloat ? TokenType::FLOATLIT : TokenType::INTLIT, lexeme, startLine, startLine};
 }
 
 /**
@@ -310,40 +287,33 @@ Token Scanner::scanNumber() {
  * @return Token The scanned token.
  */
 Token Scanner::scanOperatorOrPunctuation() {
-    std::string lexeme;
+    const char* start = cursor;
     int startLine = currentLine;
     
-    lexeme += currentChar;
     getNextChar();
     
     // Check for two-character operators
-    if (!input.eof()) {
-        std::string twoChar = lexeme + currentChar;
-        auto it = operators.find(twoChar);
-        if (it != operators.end()) {
+    if (!atEnd()) {
+        TokenType type = Lexicon::twoCharType(start[0], start[1]);
+        if (type != TokenType::COUNT) {
             getNextChar();
-            return {it->second, twoChar, startLine, startLine};
+            return {type, std::string_view(start, 2), startLine, startLine};
         }
     }
     
     // Check single-character operators and punctuation
-    auto opIt = operators.find(lexeme);
-    if (opIt != operators.end()) {
-        return {opIt->second, lexeme, startLine, startLine};
-    }
-    
-    auto punctIt = punctuation.find(lexeme);
-    if (punctIt != punctuation.end()) {
-        return {punctIt->second, lexeme, startLine, startLine};
+    TokenType type = Lexicon::singleCharType(*start);
+    if (type != TokenType::INVALID_CHAR) {
+        return {type, std::string_view(start, 1), startLine, startLine};
     }
 
     // Handle invalid identifier starting with underscore
-    if (lexeme[0] == '_') {
+    if (*start == '_') {
         Token rest = scanIdentifierOrKeyword();
-        return {"invalidid", lexeme.append(rest.lexeme) , rest.line, rest.line};
+        return {TokenType::INVALID_ID, std::string_view(start, cursor - start), rest.line, rest.line};
     }
 
-    return {"invalidchar", lexeme, startLine, startLine};
+    return {TokenType::INVALID_CHAR, std::string_view(start, 1), startLine, startLine};
 }
 
 /**
@@ -354,26 +324,135 @@ Token Scanner::scanOperatorOrPunctuation() {
 Token Scanner::getNextToken() {
     
     skipWhitespace();
-    if (input.eof()) {
-        return {"$", "", currentLine, currentLine};
+    if (atEnd()) {
+        return {TokenType::END_OF_FILE, "", currentLine, currentLine};
     }
-    
+
+    Token token = useTransitionTable ? scanWithTransitionTable() : scanWithBranches();
+    if (token.kind == TokenType::ID) {
+        if (interner) token.symbol = interner->intern(token.lexeme);
+    } else if ((token.kind == TokenType::INTLIT || token.kind == TokenType::FLOATLIT) && !decodeLiteral(token)) {
+        return {TokenType::INVALID_LIT, token.lexeme, token.line, token.endLine};
+    }
+    return token;
+}
+
+/**
+ * @brief Decode the value of an integer or float literal token.
+ * 
+ * @param token The token whose literal value to fill in.
+ * @return bool False if the value is out of range for its type.
+ */
+bool Scanner::decodeLiteral(Token& token) {
+    const char* first = token.lexeme.data();
+    const char* last = first + token.lexeme.size();
+    std::from_chars_result result{};
+    if (token.kind == TokenType::INTLIT) {
+        result = std::from_chars(first, last, token.literal.intValue);
+    } else if (token.kind == TokenType::FLOATLIT) {
+        result = std::from_chars(first, last, token.literal.floatValue);
+        if (result.ec == std::errc::result_out_of_range) {
+            // Values too small for a float round towards zero; only
+            // magnitudes beyond the float range are errors. Out of the double
+            // range too, the sign of the exponent tells which way it went.
+            double wide = 0.0;
+            bool underflow;
+            if (std::from_chars(first, last, wide).ec == std::errc::result_out_of_range) {
+                size_t exponent = token.lexeme.find_first_of("eE");
+                underflow = exponent != std::string_view::npos && exponent + 1 < token.lexeme.size() &&
+                            token.lexeme[exponent + 1] == '-';
+            } else {
+                underflow = std::abs(wide) <= std::numeric_limits<float>::max();
+            }
+            if (!underflow) return false;
+            token.literal.floatValue = static_cast<float>(wide);
+        }
+        return true;
+    }
+    return result.ec != std::errc::result_out_of_range;
+}
+
+/**
+ * @brief Scan the token at the cursor by running the LexerDFA transition table.
+ * 
+ * @return Token The scanned token.
+ */
+Token Scanner::scanWithTransitionTable() {
+    const char* start = cursor;
+    int startLine = currentLine;
+
+    const char* p = cursor;
+    uint8_t state = LexerDFA::START;
+    while (p < end) {
+        uint8_t next = LexerDFA::transitions[state][LexerDFA::charClasses[static_cast<unsigned char>(*p)]];
+        if (next == LexerDFA::DEAD) break;
+        state = next;
+        ++p;
+        // Identifiers and inline comments are runs of one state; skip them in bulk.
+        if (state == LexerDFA::IDENT || state == LexerDFA::BAD_IDENT) {
+            p = CharScan::skipIdentifierChars(p, end);
+        } else if (state == LexerDFA::INLINE_COMMENT) {
+            p = CharScan::findNewline(p, end);
+        }
+    }
+
+    // No token matched by the table spans a newline, so only the character
+    // the loop stopped on can move the line counter.
+    currentColumn += static_cast<int>(p - cursor);
+    cursor = p;
+    if (!atEnd() && *cursor == '\n') {
+        currentLine++;
+        currentColumn = 0;
+    }
+
+    std::string_view lexeme(start, cursor - start);
+    switch (LexerDFA::acceptActions[state]) {
+        case LexerDFA::ACCEPT_IDENTIFIER:
+            return {Lexicon::reservedWordType(lexeme), lexeme, startLine, startLine};
+        case LexerDFA::ACCEPT_SINGLE:
+            return {Lexicon::singleCharType(*start), lexeme, startLine, startLine};
+        case LexerDFA::ACCEPT_TWO_CHAR:
+            return {Lexicon::twoCharType(start[0], start[1]), lexeme, startLine, startLine};
+        case LexerDFA::ACCEPT_BLOCK_COMMENT:
+            scanBlockCommentBody();
+            return {TokenType::BLOCK_COMMENT, std::string_view(start, cursor - start), startLine, currentLine - 1};
+        case LexerDFA::ACCEPT_TYPE:
+        default: {
+            TokenType type = LexerDFA::acceptTypes[state];
+            if (type == TokenType::INLINE_COMMENT) {
+                return {type, lexeme, startLine, currentLine - 1};
+            }
+            if (type == TokenType::INVALID_ID && lexeme.size() == 1 && !atEnd() && *cursor == '\n') {
+                // A lone '_' is reported on the line of the character after it.
+                return {type, lexeme, currentLine, currentLine};
+            }
+            return {type, lexeme, startLine, startLine};
+        }
+    }
+}
+
+/**
+ * @brief Scan the token at the cursor with the hand-written branches.
+ * 
+ * @return Token The scanned token.
+ */
+Token Scanner::scanWithBranches() {
     // Handle comments
-    if (currentChar == '/') {
-        char nextChar = input.peek();
+    if (*cursor == '/') {
+        char nextChar = peekNextChar();
         if (nextChar == '/' || nextChar == '*') {
             int commentStartLine = currentLine; // Capture start line
             int commentEndLine = currentLine; // Capture end line
-            std::string comment = scanComment(commentEndLine);
-            return {(nextChar == '/') ? "inlinecmt" : "blockcmt", comment, commentStartLine, commentEndLine};
+            std::string_view comment = scanComment(commentEndLine);
+            return {(nextChar == '/') ? TokenType::INLINE_COMMENT : TokenType::BLOCK_COMMENT, comment, commentStartLine, commentEndLine};
         }
     }
     
-    if (isLetter(currentChar)) {
+    if (isLetter(*cursor)) {
         return scanIdentifierOrKeyword();
     }
     
-    if (isDigit(currentChar)) {
+    if (isDigit(*cursor)) {
         return scanNumber();
     }
 
@@ -381,86 +460,134 @@ Token Scanner::getNextToken() {
 }
 
 /**
- * @brief Process the entire input file and generate tokens.
+ * @brief Pack a token into its 16-byte stored form.
+ * 
+ * @param token The token to pack.
+ * @return PackedToken The packed token.
  */
-void Scanner::processFile() {
-    Token token;
-    do {
-        token = getNextToken();
-        if (token.type == "$") break;
-        tokens.push_back(token);
-    } while (true);
+PackedToken Scanner::pack(const Token& token) const {
+    PackedToken packed;
+    packed.offset = static_cast<uint32_t>(token.lexeme.data() - source->begin());
+    packed.length = static_cast<uint32_t>(token.lexeme.size());
+    packed.line = token.line;
+    packed.kind = token.kind;
+    int delta = token.endLine - token.line;
+    packed.endLineDelta = static_cast<int16_t>(std::min<int>(delta, PackedToken::MAX_END_LINE_DELTA));
+    return packed;
 }
 
 /**
- * @brief Write the generated tokens to the output file.
+ * @brief Expand a packed token into a token with views into the source.
+ * 
+ * @param token The packed token.
+ * @return Token The expanded token, without symbol or literal value.
  */
-void Scanner::writeOutputsToFile() {
-    Token token;
-    std::string currentOutput;
-    int lastLine = -1; // Track the last line number of the output
-    
-    for (auto it = tokens.begin(); it != tokens.end(); ++it) {
-            
-        token = *it;
-        
-        if (token.type.substr(0,7) == "invalid") {
-            reportError(token);
-        }
+Token Scanner::expand(const PackedToken& token) const {
+    std::string_view lexeme(source->begin() + token.offset, token.length);
+    int endLine = token.line + token.endLineDelta;
+    if (token.endLineDelta == PackedToken::MAX_END_LINE_DELTA) {
+        // Too many lines to store: count them again, the same way scanComment() does.
+        const char* after = lexeme.data() + lexeme.size();
+        endLine = token.line + static_cast<int>(std::count(lexeme.begin(), lexeme.end(), '\n'))
+                + ((after < source->end() && *after == '\n') ? 1 : 0) - 1;
+    }
+    return Token(token.kind, lexeme, static_cast<int>(token.line), endLine);
+}
 
-        // Format the token output
-        std::string tokenStr = "[" + token.type + ", " + token.lexeme + ", " + std::to_string(token.line) + "]";
-        
-        // Check if the current token's line is greater than the last line + 1
-        if (lastLine != -1 && token.line > lastLine + 3) {
-            // If there is a gap between the last token's line and the current token's line,
-            // output the current line of tokens and add empty lines for the gap.
-            tokenOutput << currentOutput << "\n";
-            tokenOutput << "\n";
-            // Start a new line with the current token.
-            currentOutput = tokenStr;
-        } else if (!currentOutput.empty() && token.line != lastLine) {
-            // If the current token is on a new line, output the current line of tokens.
-            tokenOutput << currentOutput << "\n";
-            // Start a new line with the current token.
-            currentOutput = tokenStr;
-        } else {
-            // If the current token is on the same line, append it to the current line of tokens.
-            if (!currentOutput.empty()) {
-            currentOutput += " ";
+/**
+ * @brief Expand a packed token, interning or decoding its lexeme again.
+ * 
+ * @param token The packed token.
+ * @return Token The expanded token.
+ */
+Token Scanner::unpack(const PackedToken& token) const {
+    Token result = expand(token);
+    if (interner && token.kind == TokenType::ID) {
+        result.symbol = interner->intern(result.lexeme);
+    } else if (token.kind == TokenType::INTLIT || token.kind == TokenType::FLOATLIT) {
+        decodeLiteral(result);
+    }
+    return result;
+}
+
+/**
+ * @brief Expand a packed token with the value it was scanned with.
+ * 
+ * @param token The packed token.
+ * @param value The symbol and literal value of the token.
+ * @return Token The expanded token.
+ */
+Token Scanner::unpack(const PackedToken& token, const TokenValue& value) const {
+    Token result = expand(token);
+    result.symbol = value.symbol;
+    result.literal = value.literal;
+    return result;
+}
+
+/**
+ * @brief Scan the entire input, writing the tokens to the output sink or output files.
+ * 
+ * @param threads Number of threads to lex with.
+ */
+void Scanner::processFile(unsigned threads) {
+    std::unique_ptr<TokenWriter> writer;
+    TokenSink* sink = output;
+    if (!sink && !outputBase.empty()) {
+        writer = std::make_unique<TokenWriter>(outputBase);
+        sink = writer.get();
+    }
+
+    size_t chunks = ParallelLexer::chunkCountFor(source->size(), threads);
+    if (chunks > 1 && cursor == source->begin()) {
+        ParallelLexer lexer(source, chunks);
+        std::vector<PackedToken> tokens = lexer.run();
+        if (sink) {
+            for (const PackedToken& token : tokens) {
+                sink->write(unpack(token));
             }
-            currentOutput += tokenStr;
+            sink->finish();
         }
-        // Update the last processed line number.
-        lastLine = token.endLine;
-        
+        return;
     }
+    TokenStream stream(*this);
+    stream.setTee(sink);
+    stream.drain();
+}
 
-    // Output remaining tokens
-    if (!currentOutput.empty()) {
-        tokenOutput << currentOutput << "\n";
+/**
+ * @brief Move the scanner to a token boundary.
+ * 
+ * @param offset Byte offset of the first character of a token, or of whitespace between tokens.
+ * @param line The line counter at that position.
+ */
+void Scanner::seek(size_t offset, int line) {
+    cursor = source->begin() + std::min(offset, source->size());
+    currentLine = line;
+    const char* lineStart = cursor;
+    while (lineStart > source->begin() && lineStart[-1] != '\n') --lineStart;
+    currentColumn = static_cast<int>(cursor - lineStart) + 1;
+}
+
+/**
+ * @brief Build the line index on first use.
+ */
+std::shared_ptr<const LineIndex> Scanner::getLineIndex() {
+    if (!lineIndex) {
+        lineIndex = std::make_shared<const LineIndex>(*source);
     }
-    
+    return lineIndex;
 }
 
 /**
- * @brief Report lexical errors to the error output stream.
+ * @brief Locate a token through the line index.
  * 
- * @param message The error message.
- * @param lexeme The lexeme that caused the error.
+ * @param token A token whose lexeme points into the source buffer.
+ * @return The line and column of the token.
  */
-void Scanner::reportError(const Token& token) {
-    std::string niceMessage;
-    std::string message = token.type;
-    if (message == "invalidid") {
-        niceMessage = "Invalid identifier";
-    } else if (message == "invalidlit") {
-        niceMessage = "Invalid literal";
-    } else if (message == "invalidchar") {
-        niceMessage = "Invalid character";
-    } else {
-        niceMessage = "Unknown error";
+SourcePosition Scanner::locate(const Token& token) {
+    const char* start = token.lexeme.data();
+    if (start < source->begin() || start > source->end()) {
+        start = source->end();
     }
-
-    errorOutput << "Lexical error: " << niceMessage << ": \"" << token.lexeme << "\": line " << token.line << "." << std::endl;
-}
\ No newline at end of file
+    return getLineIndex()->locate(static_cast<size_t>(start - source->begin()));
+}
@@ -2,37 +2,15 @@
 #define SCANNER_H
 
 #include <string>
+#include <string_view>
 #include <fstream>
+#include <memory>
 #include <vector>
-#include <unordered_map>
+#include "SourceBuffer.h"
+#include "LineIndex.h"
+#include "Token.h"
 
-/**
- * @enum TokenType
- * @brief Enumeration of possible token types.
- */
-enum class TokenType {
-    ID,                ///< Identifier
-    INTLIT,            ///< Integer literal
-    FLOATLIT,          ///< Floating-point literal
-    OPERATOR,          ///< Operator
-    PUNCTUATION,       ///< Punctuation
-    RESERVED_WORD,     ///< Reserved word
-    INLINE_COMMENT,    ///< Inline comment
-    BLOCK_COMMENT,     ///< Block comment
-    ERROR,             ///< Error
-    END_OF_FILE        ///< End of file
-};
-
-/**
- * @struct Token
- * @brief Structure representing a token.
- */
-struct Token {
-    std::string type;    ///< The token type as a string (e.g., "id", "intlit")
-    std::string lexeme;  ///< The actual text of the token
-    int line;            ///< Line number where the token starts
-    int endLine;         ///< End line number (for block comments)
-};
+class TokenSink;
 
 /**
  * @class Scanner
@@ -42,6 +20,9 @@ struct Token {
  * It supports various token types such as identifiers, numbers, operators,
  * punctuation, reserved words, and comments.
  * 
+ * The whole input is held in a SourceBuffer (memory-mapped for files) and
+ * scanned with raw pointers; token lexemes are views into that buffer.
+ * 
  * 
  * @author @TheBarzani
  * @date 2025-01-26
@@ -61,6 +42,39 @@ public:
      */
     Scanner(const std::string& in, const std::string& out);
 
+    /**
+     * @brief Constructor that scans an already loaded source buffer.
+     * @param source The source buffer to scan; shared with every copy of the scanner.
+     * @param out The output file path for tokens and errors (without extension).
+     */
+    Scanner(std::shared_ptr<const SourceBuffer> source, const std::string& out);
+
+    /**
+     * @brief Constructor that scans a caller-owned buffer in memory.
+     *
+     * Nothing is read from or written to disk: processFile() hands the tokens
+     * to the given sink, or only scans if there is none.
+     *
+     * @param data Pointer to the first byte of the source text. It is borrowed
+     *             and must outlive the scanner and its tokens.
+     * @param size Number of bytes in the source text.
+     * @param output Optional sink that receives the tokens in processFile().
+     */
+    Scanner(const char* data, size_t size, TokenSink* output = nullptr);
+
+    /**
+     * @brief Creates a scanner over source text held in memory.
+     *
+     * The scanner keeps the text in its source buffer, so tokens stay valid
+     * after the caller's string is gone. Otherwise it behaves like the
+     * borrowing constructor above.
+     *
+     * @param text The source text itself (not a path).
+     * @param output Optional sink that receives the tokens in processFile().
+     * @return The scanner.
+     */
+    static Scanner fromText(std::string text, TokenSink* output = nullptr);
+
     /**
      * @brief Copy constructor that creates a scanner as a copy of another scanner.
      * @param other The scanner to copy.
@@ -68,31 +82,73 @@ public:
     Scanner(const Scanner& other);
 
     /**
-     * @brief Destructor for the Scanner class.
+     * @brief Copy assignment that makes this scanner resume where another one is.
+     * @param other The scanner to copy.
+     * @return This scanner.
      */
-    ~Scanner();
-    
+    Scanner& operator=(const Scanner& other) = default;
+
     /**
      * @brief Retrieves the next token from the input file.
+     *
+     * Integer and float literals come with their decoded value. A literal too
+     * large for its type is returned as an invalid literal, so the overflow
+     * is reported once, as a lexical error. Identifiers are interned if the
+     * scanner has an interner, on the thread that scans.
+     *
      * @return The next token.
      */
     Token getNextToken();
 
     /**
-     * @brief Processes the entire input file and generates tokens.
+     * @brief Scans the entire input, handing every token to the output sink.
+     *
+     * Without a sink, a scanner with an output path writes the tokens and
+     * errors to <output path>.outlextokens and <output path>.outlexerrors.
+     * Tokens are streamed as they are scanned and are not kept. To consume
+     * tokens instead, pull them through a TokenStream.
+     *
+     * @param threads Number of threads to lex with. Large inputs are split
+     *                into chunks lexed by a ParallelLexer; the output is the
+     *                same as with a single thread.
+     */
+    void processFile(unsigned threads = 1);
+
+    /**
+     * @brief Retrieves the output file path (without extension).
+     * @return The path the output files are written to.
+     */
+    const std::string& getOutputBase() const { return outputBase; }
+
+    /**
+     * @brief Sets the sink processFile() writes to instead of the output files.
+     * @param output The sink, or nullptr to use the output files again.
      */
-    void processFile();
+    void setOutput(TokenSink* output) { this->output = output; }
 
     /**
-     * @brief Writes the token and error outputs to files.
+     * @brief Packs a token into its 16-byte stored form.
+     * @param token The token to pack; its lexeme must point into this scanner's source.
+     * @return The packed token.
      */
-    void writeOutputsToFile();
+    PackedToken pack(const Token& token) const;
 
     /**
-     * @brief Retrieves the tokens generated by the scanner.
-     * @return The vector of tokens.
+     * @brief Expands a packed token, deriving its type name and lexeme views.
+     * Identifiers are interned if the scanner has an interner, and literals
+     * are decoded again from their lexeme.
+     * @param token The packed token.
+     * @return The token with views into the source buffer.
      */
-    std::vector<Token> getTokens() const { return tokens; }
+    Token unpack(const PackedToken& token) const;
+
+    /**
+     * @brief Expands a packed token whose symbol and literal value were kept aside.
+     * @param token The packed token.
+     * @param value The value the token was scanned with.
+     * @return The token with views into the source buffer.
+     */
+    Token unpack(const PackedToken& token, const TokenValue& value) const;
 
     /**
      * @brief Retrieves the total number of lines in the scanned source file.
@@ -100,22 +156,95 @@ public:
      */
     int getLineCount() const { return currentLine; }
 
+    /**
+     * @brief Selects how tokens are recognised.
+     * @param enabled True to run the LexerDFA transition table (the default),
+     *                false to use the hand-written scanning branches.
+     */
+    void setUseTransitionTable(bool enabled) { useTransitionTable = enabled; }
+
+    /**
+     * @brief Retrieves the source buffer the token lexemes point into.
+     * @return The shared source buffer.
+     */
+    std::shared_ptr<const SourceBuffer> getSource() const { return source; }
+
+    /**
+     * @brief Sets the interner identifiers are interned into when tokens are
+     * scanned or unpacked, filling Token::symbol.
+     * @param interner The session's interner, or nullptr to leave symbols unset.
+     */
+    void setInterner(StringInterner* interner) { this->interner = interner; }
+
+    /**
+     * @brief Retrieves the interner identifiers are interned into.
+     * @return The interner, or nullptr.
+     */
+    StringInterner* getInterner() const { return interner; }
+
+    /**
+     * @brief Retrieves the line start index of the source buffer.
+     *
+     * The index is built on first use and shared with copies of the scanner
+     * made afterwards.
+     *
+     * @return The shared line index.
+     */
+    std::shared_ptr<const LineIndex> getLineIndex();
+
+    /**
+     * @brief Finds the line and column of a token.
+     * @param token A token scanned from this scanner's source.
+     * @return The position of the token's first character.
+     */
+    SourcePosition locate(const Token& token);
+
+    /**
+     * @brief Moves the scanner to a token boundary of its source.
+     * @param offset Byte offset of the first character of a token, or of
+     *               whitespace between two tokens.
+     * @param line The line counter at that position: one plus the number of
+     *             newlines in [0, offset], so a newline at offset counts.
+     */
+    void seek(size_t offset, int line);
+
 private:
-    std::ifstream input;                ///< Input file stream
+    std::shared_ptr<const SourceBuffer> source; ///< Source text being scanned
+    const char* cursor;                 ///< Position of the current character
+    const char* end;                    ///< One past the last character of the source
     std::string filename;               ///< Name of the input file
+    std::string outputBase;             ///< Output file path without extension
     int currentLine;                    ///< Current line number
     int currentColumn;                  ///< Current column number
-    char currentChar;                   ///< Current character being processed
-    std::ofstream tokenOutput;          ///< Output file stream for tokens
-    std::ofstream errorOutput;          ///< Output file stream for errors
-    std::string currentLineText;        ///< Text of the current line being processed
-    std::vector<Token> tokens;          ///< Vector to store tokens
+    std::shared_ptr<const LineIndex> lineIndex; ///< Line starts of the source, built on demand
+    bool useTransitionTable = true;     ///< Scan with the LexerDFA table instead of branches
+    StringInterner* interner = nullptr; ///< Interner for identifier symbols (not owned)
+    TokenSink* output = nullptr;        ///< Sink for processFile(), overriding the output files
     
     /**
-     * @brief Retrieves the next character from the input file.
+     * @brief Advances to the next character of the source buffer.
      */
     void getNextChar();
 
+    /**
+     * @brief Moves the cursor forward to the given position, keeping the
+     * line and column counters as if getNextChar() had been called repeatedly.
+     * @param target Position in [cursor, end] to move to.
+     */
+    void advanceTo(const char* target);
+
+    /**
+     * @brief Checks whether the whole source buffer has been consumed.
+     * @return True if there are no characters left.
+     */
+    bool atEnd() const { return cursor >= end; }
+
+    /**
+     * @brief Peeks at the character after the current one.
+     * @return The next character, or '\0' past the end of the buffer.
+     */
+    char peekNextChar() const { return cursor + 1 < end ? cursor[1] : '\0'; }
+
     /**
      * @brief Skips whitespace characters in the input file.
      */
@@ -126,7 +255,38 @@ private:
      * @param endLine Reference to store the end line number of the comment.
      * @return The comment text.
      */
-    std::string scanComment(int& endLine);
+    std::string_view scanComment(int& endLine);
+
+    /**
+     * @brief Consumes the body of a block comment, honouring nested comments.
+     */
+    void scanBlockCommentBody();
+
+    /**
+     * @brief Expands a packed token without interning or decoding its lexeme.
+     * @param token The packed token.
+     * @return The token with views into the source buffer.
+     */
+    Token expand(const PackedToken& token) const;
+
+    /**
+     * @brief Decodes the value of an integer or float literal token.
+     * @param token The token; its literal value is filled in.
+     * @return False if the value does not fit its type, true otherwise.
+     */
+    static bool decodeLiteral(Token& token);
+
+    /**
+     * @brief Scans one token with the compile-time LexerDFA transition table.
+     * @return The scanned token.
+     */
+    Token scanWithTransitionTable();
+
+    /**
+     * @brief Scans one token with the hand-written scanning branches.
+     * @return The scanned token.
+     */
+    Token scanWithBranches();
 
     /**
      * @brief Checks if a character is a letter.
@@ -166,23 +326,6 @@ private:
      * @return The scanned token.
      */
     Token scanOperatorOrPunctuation();
-    
-    /**
-     * @brief Reports an error encountered during scanning.
-     * @param message The error message.
-     * @param lexeme The lexeme that caused the error.
-     */
-    void reportError(const Token& token);
-
-    /**
-     * @brief Retrieves the current line of text being processed.
-     * @return The current line of text.
-     */
-    // std::string getCurrentLine();
-
-    static const std::unordered_map<std::string, std::string> reservedWords; ///< Map of reserved words
-    static const std::unordered_map<std::string, std::string> operators;     ///< Map of operators
-    static const std::unordered_map<std::string, std::string> punctuation;   ///< Map of punctuation
 };
 
 #endif // SCANNER_H
\ No newline at end of file
@@ -0,0 +1,73 @@
+/**
+ * @file SourceBuffer.cpp
+ * @brief Implementation of the SourceBuffer class.
+ *
+ * @date 2026-10-17
+ * @author @TheBarzani
+ */
+
+#include "SourceBuffer.h"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+SourceBuffer::SourceBuffer(const std::string& path)
+    : path(path), data(""), length(0), mapping(nullptr) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Unable to open file " + path);
+    }
+
+    struct stat info;
+    if (::fstat(fd, &info) == 0 && S_ISREG(info.st_mode)) {
+        if (info.st_size > 0) {
+            void* base = ::mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (base != MAP_FAILED) {
+                ::madvise(base, info.st_size, MADV_SEQUENTIAL);
+                mapping = base;
+                data = static_cast<const char*>(base);
+                length = info.st_size;
+            }
+        } else {
+            // Empty regular file: nothing to map.
+            ::close(fd);
+            return;
+        }
+    }
+    ::close(fd);
+
+    if (mapping == nullptr) {
+        // Not mappable, read it the slow way.
+        std::ifstream input(path, std::ios::binary);
+        if (!input.is_open()) {
+            throw std::runtime_error("Unable to open file " + path);
+        }
+        std::ostringstream contents;
+        contents << input.rdbuf();
+        fallback = contents.str();
+        data = fallback.data();
+        length = fallback.size();
+    }
+}
+
+SourceBuffer::SourceBuffer(const char* data, std::size_t size)
+    : data(data), length(size), mapping(nullptr) {
+}
+
+std::shared_ptr<const SourceBuffer> SourceBuffer::fromText(std::string text) {
+    auto buffer = std::make_shared<SourceBuffer>(nullptr, 0);
+    buffer->fallback = std::move(text);
+    buffer->data = buffer->fallback.data();
+    buffer->length = buffer->fallback.size();
+    return buffer;
+}
+
+SourceBuffer::~SourceBuffer() {
+    if (mapping != nullptr) {
+        ::munmap(mapping, length);
+    }
+}
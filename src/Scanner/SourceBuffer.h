@@ -0,0 +1,80 @@
+/**
+ * @file SourceBuffer.h
+ * @brief Read-only view over the bytes of a source file.
+ *
+ * A SourceBuffer either memory-maps a file from disk, holds source text
+ * handed over to it, or wraps a buffer owned by the caller. The Scanner walks the buffer with raw pointers and hands out
+ * lexemes as std::string_view slices of it, so the buffer must outlive every
+ * token produced from it. Scanners share the buffer through a shared_ptr.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#ifndef SOURCEBUFFER_H
+#define SOURCEBUFFER_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+/**
+ * @class SourceBuffer
+ * @brief Owns (or borrows) the contiguous text of one source file.
+ */
+class SourceBuffer {
+public:
+    /**
+     * @brief Maps the given file into memory.
+     *
+     * Falls back to reading the file into an owned string when the file cannot
+     * be mapped (e.g. pipes or special files).
+     *
+     * @param path The input file path.
+     * @throws std::runtime_error If the file cannot be opened.
+     */
+    explicit SourceBuffer(const std::string& path);
+
+    /**
+     * @brief Wraps a caller-owned buffer without copying it.
+     * @param data Pointer to the first byte of the source text.
+     * @param size Number of bytes in the source text.
+     */
+    SourceBuffer(const char* data, std::size_t size);
+
+    /**
+     * @brief Creates a buffer that owns the given source text.
+     * @param text The source text itself (not a path).
+     * @return The buffer, holding the text for as long as it is shared.
+     */
+    static std::shared_ptr<const SourceBuffer> fromText(std::string text);
+
+    SourceBuffer(const SourceBuffer&) = delete;
+    SourceBuffer& operator=(const SourceBuffer&) = delete;
+
+    /**
+     * @brief Unmaps the file if it was mapped.
+     */
+    ~SourceBuffer();
+
+    const char* begin() const { return data; }
+    const char* end() const { return data + length; }
+    std::size_t size() const { return length; }
+    std::string_view text() const { return std::string_view(data, length); }
+
+    /**
+     * @brief Retrieves the path the buffer was loaded from.
+     * @return The file path, or an empty string for caller-owned buffers.
+     */
+    const std::string& getPath() const { return path; }
+
+private:
+    std::string path;           ///< Path of the mapped file (empty for borrowed buffers)
+    const char* data;           ///< First byte of the source text
+    std::size_t length;         ///< Number of bytes in the source text
+    void* mapping;              ///< Base address of the mapping, or nullptr
+    std::string fallback;       ///< Owned text: the file when it cannot be mapped, or fromText()
+};
+
+#endif // SOURCEBUFFER_H
@@ -0,0 +1,25 @@
+/**
+ * @file StringInterner.cpp
+ * @brief Implementation of the string interner.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#include "StringInterner.h"
+
+SymbolId StringInterner::intern(std::string_view text) {
+    auto it = ids.find(text);
+    if (it != ids.end()) {
+        return it->second;
+    }
+    SymbolId id = static_cast<SymbolId>(strings.size());
+    const std::string& stored = strings.emplace_back(text);
+    ids.emplace(std::string_view(stored), id);
+    return id;
+}
+
+SymbolId StringInterner::find(std::string_view text) const {
+    auto it = ids.find(text);
+    return it != ids.end() ? it->second : NO_SYMBOL;
+}
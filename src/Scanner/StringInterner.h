@@ -0,0 +1,73 @@
+/**
+ * @file StringInterner.h
+ * @brief Maps identifier spellings to dense integer IDs.
+ *
+ * Every distinct string is stored once and numbered in order of first
+ * appearance. The scanner interns identifiers as it hands them out, so later
+ * phases can compare names by ID and key tables on an integer instead of
+ * hashing the spelling again at every lookup.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#ifndef STRINGINTERNER_H
+#define STRINGINTERNER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/// Dense ID of an interned string.
+using SymbolId = uint32_t;
+
+/// Marks a name that has not been interned.
+inline constexpr SymbolId NO_SYMBOL = UINT32_MAX;
+
+/**
+ * @class StringInterner
+ * @brief Owns one copy of every interned string.
+ *
+ * Views returned by lookup() stay valid for the lifetime of the interner.
+ */
+class StringInterner {
+public:
+    StringInterner() = default;
+    StringInterner(const StringInterner&) = delete;
+    StringInterner& operator=(const StringInterner&) = delete;
+
+    /**
+     * @brief Retrieves the ID of a string, adding it if it is new.
+     * @param text The string to intern.
+     * @return The ID of the string.
+     */
+    SymbolId intern(std::string_view text);
+
+    /**
+     * @brief Retrieves the ID of a string without adding it.
+     * @param text The string to look up.
+     * @return The ID of the string, or NO_SYMBOL if it was never interned.
+     */
+    SymbolId find(std::string_view text) const;
+
+    /**
+     * @brief Retrieves the string with the given ID.
+     * @param id An ID returned by intern().
+     * @return The interned string.
+     */
+    std::string_view lookup(SymbolId id) const { return strings[id]; }
+
+    /**
+     * @brief Retrieves the number of interned strings.
+     */
+    size_t size() const { return strings.size(); }
+
+private:
+    std::deque<std::string> strings;                     ///< Interned strings by ID; never relocated
+    std::unordered_map<std::string_view, SymbolId> ids;  ///< IDs by string, viewing into strings
+};
+
+#endif // STRINGINTERNER_H
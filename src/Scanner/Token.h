@@ -0,0 +1,176 @@
+/**
+ * @file Token.h
+ * @brief Token kinds and the two token representations used by the Scanner.
+ *
+ * Tokens are stored as 16-byte PackedToken records (kind, source offset, length
+ * and line). The richer Token struct is what the scanner hands out one at a
+ * time; its type name and lexeme are views derived on demand from the kind and
+ * the source buffer. Integer and float literals also carry their decoded
+ * value, so no later phase parses digit strings.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#ifndef TOKEN_H
+#define TOKEN_H
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include "StringInterner.h"
+
+/**
+ * @enum TokenType
+ * @brief Enumeration of possible token types.
+ *
+ * Every terminal of the grammar has its own kind, followed by the comment and
+ * error kinds the parser filters out.
+ */
+enum class TokenType : uint16_t {
+    ID,                ///< Identifier
+    INTLIT,            ///< Integer literal
+    FLOATLIT,          ///< Floating-point literal
+
+    // Operators
+    EQ, NEQ, LT, GT, LEQ, GEQ,
+    PLUS, MINUS, MULT, DIV,
+    ASSIGN, ARROW,
+
+    // Punctuation
+    LPAR, RPAR, LCURBR, RCURBR, LSQBR, RSQBR,
+    COMMA, DOT, COLON, SEMI,
+
+    // Reserved words
+    INT, FLOAT, VOID, CLASS, SELF, ISA, WHILE, IF, THEN, ELSE,
+    READ, WRITE, RETURN, LOCAL, CONSTRUCTOR, ATTRIBUTE, FUNCTION,
+    PUBLIC, PRIVATE, IMPLEMENTATION, OR, AND, NOT,
+
+    INLINE_COMMENT,    ///< Inline comment
+    BLOCK_COMMENT,     ///< Block comment
+    INVALID_ID,        ///< Error: invalid identifier
+    INVALID_LIT,       ///< Error: invalid literal
+    INVALID_CHAR,      ///< Error: invalid character
+    END_OF_FILE,       ///< End of file ("$")
+
+    COUNT              ///< Number of token kinds
+};
+
+/**
+ * @brief Token type names as they appear in .outlextokens and the parsing table.
+ */
+inline constexpr std::array<std::string_view, static_cast<size_t>(TokenType::COUNT)> tokenTypeNames = {
+    "id", "intlit", "floatlit",
+    "eq", "neq", "lt", "gt", "leq", "geq",
+    "plus", "minus", "mult", "div",
+    "assign", "arrow",
+    "lpar", "rpar", "lcurbr", "rcurbr", "lsqbr", "rsqbr",
+    "comma", "dot", "colon", "semi",
+    "int", "float", "void", "class", "self", "isa", "while", "if", "then", "else",
+    "read", "write", "return", "local", "constructor", "attribute", "function",
+    "public", "private", "implementation", "or", "and", "not",
+    "inlinecmt", "blockcmt", "invalidid", "invalidlit", "invalidchar", "$"
+};
+
+/**
+ * @brief Retrieves the name of a token type.
+ * @param type The token type.
+ * @return The name used in the output files and the parsing table.
+ */
+constexpr std::string_view tokenTypeName(TokenType type) {
+    return tokenTypeNames[static_cast<size_t>(type)];
+}
+
+/**
+ * @brief Looks up a token type by name.
+ * @param name The token type name (e.g. "id", "$").
+ * @param type Receives the token type if the name is known.
+ * @return True if the name is a token type name, false otherwise.
+ */
+inline bool tokenTypeFromName(std::string_view name, TokenType& type) {
+    for (size_t i = 0; i < tokenTypeNames.size(); ++i) {
+        if (tokenTypeNames[i] == name) {
+            type = static_cast<TokenType>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Checks if a token type is a comment.
+ */
+constexpr bool isCommentType(TokenType type) {
+    return type == TokenType::INLINE_COMMENT || type == TokenType::BLOCK_COMMENT;
+}
+
+/**
+ * @brief Checks if a token type is a lexical error.
+ */
+constexpr bool isErrorType(TokenType type) {
+    return type == TokenType::INVALID_ID || type == TokenType::INVALID_LIT ||
+           type == TokenType::INVALID_CHAR;
+}
+
+/**
+ * @struct LiteralValue
+ * @brief Numeric value of an integer or float literal, decoded by the scanner.
+ *
+ * Only the field matching the literal's kind is meaningful; the other stays 0.
+ */
+struct LiteralValue {
+    int32_t intValue = 0;      ///< Value of an integer literal
+    float floatValue = 0.0f;   ///< Value of a float literal
+};
+
+/**
+ * @struct Token
+ * @brief Structure representing a token.
+ */
+struct Token {
+    TokenType kind = TokenType::END_OF_FILE; ///< The token type
+    std::string_view type = "$";             ///< The token type as a string (e.g., "id", "intlit")
+    std::string_view lexeme;                 ///< The actual text of the token, a slice of the source buffer
+    int line = 0;                            ///< Line number where the token starts
+    int endLine = 0;                         ///< End line number (for block comments)
+    SymbolId symbol = NO_SYMBOL;             ///< Interned identifier, if the scanner has an interner
+    LiteralValue literal;                    ///< Decoded value of an integer or float literal
+
+    Token() = default;
+    Token(TokenType kind, std::string_view lexeme, int line, int endLine)
+        : kind(kind), type(tokenTypeName(kind)), lexeme(lexeme), line(line), endLine(endLine) {}
+};
+
+/**
+ * @struct PackedToken
+ * @brief Compact 16-byte token record stored in token arrays.
+ *
+ * The lexeme is not stored; it is the slice [offset, offset + length) of the
+ * source buffer the token was scanned from.
+ */
+struct PackedToken {
+    uint32_t offset;       ///< Byte offset of the first character of the token
+    uint32_t length;       ///< Length of the lexeme in bytes
+    uint32_t line;         ///< Line number where the token starts
+    TokenType kind;        ///< The token type
+    int16_t endLineDelta;  ///< endLine - line, saturated at MAX_END_LINE_DELTA
+
+    /// Marks a delta too large to store; the end line is recomputed from the source.
+    static constexpr int16_t MAX_END_LINE_DELTA = INT16_MAX;
+};
+
+static_assert(sizeof(PackedToken) == 16, "PackedToken must stay 16 bytes");
+
+/**
+ * @struct TokenValue
+ * @brief What the scanner derived from a token's lexeme when it scanned it.
+ *
+ * Kept next to a PackedToken so that expanding the token does not intern or
+ * decode its lexeme again.
+ */
+struct TokenValue {
+    SymbolId symbol = NO_SYMBOL; ///< Interned identifier, if any
+    LiteralValue literal;        ///< Decoded literal value, if any
+};
+
+#endif // TOKEN_H
@@ -0,0 +1,81 @@
+/**
+ * @file TokenPipeline.cpp
+ * @brief Implementation of the threaded scanner-to-consumer token pipeline.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#include "TokenPipeline.h"
+
+TokenPipeline::TokenPipeline(Scanner& scanner, TokenSink* tee) : scanner(scanner), tee(tee) {
+    // Build the line index now: the consumer locates tokens through it for
+    // error messages while the producer is scanning.
+    scanner.getLineIndex();
+    for (std::vector<Token>& slot : slots) {
+        slot.reserve(BATCH_SIZE);
+    }
+    producer = std::thread(&TokenPipeline::produce, this);
+}
+
+TokenPipeline::~TokenPipeline() {
+    stopping.store(true, std::memory_order_release);
+    if (producer.joinable()) {
+        producer.join();
+    }
+}
+
+void TokenPipeline::produce() {
+    bool done = false;
+    while (!done) {
+        const size_t slot = tail.load(std::memory_order_relaxed);
+        // Wait for the consumer to free a slot.
+        while (slot - head.load(std::memory_order_acquire) == QUEUE_BATCHES) {
+            if (stopping.load(std::memory_order_acquire)) return;
+            std::this_thread::yield();
+        }
+        std::vector<Token>& batch = slots[slot & SLOT_MASK];
+        batch.clear();
+        while (batch.size() < BATCH_SIZE) {
+            Token token = scanner.getNextToken();
+            batch.push_back(token);
+            if (token.kind == TokenType::END_OF_FILE) {
+                if (tee) tee->finish();
+                done = true;
+                break;
+            }
+            if (tee) tee->write(token);
+        }
+        tail.store(slot + 1, std::memory_order_release);
+        if (stopping.load(std::memory_order_acquire)) return;
+    }
+}
+
+Token TokenPipeline::next() {
+    if (finished) return endOfFile;
+    const size_t slot = head.load(std::memory_order_relaxed);
+    // Wait for the producer to publish the batch.
+    while (tail.load(std::memory_order_acquire) == slot) {
+        std::this_thread::yield();
+    }
+    const std::vector<Token>& batch = slots[slot & SLOT_MASK];
+    Token token = batch[position++];
+    if (position == batch.size()) {
+        position = 0;
+        head.store(slot + 1, std::memory_order_release);
+    }
+    if (token.kind == TokenType::END_OF_FILE) {
+        finished = true;
+        endOfFile = token;
+    }
+    return token;
+}
+
+void TokenPipeline::drain() {
+    while (!finished) {
+        next();
+    }
+    if (producer.joinable()) {
+        producer.join();
+    }
+}
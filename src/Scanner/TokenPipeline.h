@@ -0,0 +1,91 @@
+/**
+ * @file TokenPipeline.h
+ * @brief Scans on a producer thread while the consumer (usually the Parser) takes tokens.
+ *
+ * The producer thread scans the whole source, filling batches of tokens and
+ * publishing them through a lock-free single-producer/single-consumer queue of
+ * fixed batch slots. The consumer takes tokens from the published batches, so
+ * scanning and parsing overlap and a large file takes about as long as the
+ * slower of the two instead of their sum. Tokens are handed over fully decoded
+ * (interned identifier, literal value), so the consumer never touches the
+ * scanner's mutable state. Identifiers are interned by the producer, so the
+ * scanner's interner belongs to the producer thread until the pipeline is
+ * drained or destroyed.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#ifndef TOKENPIPELINE_H
+#define TOKENPIPELINE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include "Scanner.h"
+#include "TokenStream.h"
+
+/**
+ * @class TokenPipeline
+ * @brief Bounded queue of token batches fed by a scanner on its own thread.
+ */
+class TokenPipeline {
+public:
+    static constexpr size_t BATCH_SIZE = 256;    ///< Tokens per batch
+    static constexpr size_t QUEUE_BATCHES = 8;   ///< Batch slots in the queue (a power of two)
+
+    /**
+     * @brief Starts scanning on a producer thread.
+     * @param scanner The scanner to pull from. Only the producer thread uses it,
+     *                and its interner, until the pipeline is drained or destroyed.
+     * @param tee Optional sink that receives every scanned token, on the producer thread.
+     */
+    explicit TokenPipeline(Scanner& scanner, TokenSink* tee = nullptr);
+
+    /**
+     * @brief Stops the producer thread, even if the source has not been fully scanned.
+     */
+    ~TokenPipeline();
+
+    TokenPipeline(const TokenPipeline&) = delete;
+    TokenPipeline& operator=(const TokenPipeline&) = delete;
+
+    /**
+     * @brief Consumes and returns the next token of any kind, waiting for the producer if needed.
+     * @return The token, or END_OF_FILE (repeatedly) once the source is exhausted.
+     */
+    Token next();
+
+    /**
+     * @brief Consumes the rest of the source and waits for the producer thread to finish.
+     *
+     * Afterwards the tee has seen every token and the scanner may be used again.
+     */
+    void drain();
+
+private:
+    static constexpr size_t SLOT_MASK = QUEUE_BATCHES - 1;
+    static_assert((QUEUE_BATCHES & SLOT_MASK) == 0, "QUEUE_BATCHES must be a power of two");
+
+    Scanner& scanner;                                ///< Source of the tokens, used by the producer
+    TokenSink* tee;                                  ///< Optional copy of the stream, written by the producer
+    std::array<std::vector<Token>, QUEUE_BATCHES> slots; ///< Batch slots, reused round-robin
+
+    alignas(64) std::atomic<size_t> head{0};         ///< Batches consumed; written by the consumer
+    alignas(64) std::atomic<size_t> tail{0};         ///< Batches published; written by the producer
+    std::atomic<bool> stopping{false};               ///< Asks the producer to give up early
+
+    size_t position = 0;                             ///< Next token in the consumer's current batch
+    bool finished = false;                           ///< True once the consumer has seen END_OF_FILE
+    Token endOfFile;                                 ///< The END_OF_FILE token, returned repeatedly
+    std::thread producer;                            ///< Thread running produce()
+
+    /**
+     * @brief Scans the source into batches until END_OF_FILE or until stopped.
+     */
+    void produce();
+};
+
+#endif // TOKENPIPELINE_H
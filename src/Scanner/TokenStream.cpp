@@ -0,0 +1,67 @@
+/**
+ * @file TokenStream.cpp
+ * @brief Implementation of the pull-based TokenStream.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#include "TokenStream.h"
+
+TokenStream::TokenStream(Scanner& scanner, size_t capacity) : scanner(scanner) {
+    size_t size = 1;
+    while (size < capacity) size <<= 1;
+    ring.resize(size);
+    values.resize(size);
+    mask = size - 1;
+}
+
+void TokenStream::refill() {
+    while (count < ring.size() && !exhausted) {
+        Token token = scanner.getNextToken();
+        if (token.kind == TokenType::END_OF_FILE) {
+            exhausted = true;
+            if (tee) tee->finish();
+            break;
+        }
+        if (tee) tee->write(token);
+        const size_t slot = (head + count) & mask;
+        ring[slot] = scanner.pack(token);
+        values[slot] = {token.symbol, token.literal};
+        count++;
+    }
+}
+
+Token TokenStream::next() {
+    if (count == 0) refill();
+    if (count == 0) return endOfFile();
+    const size_t slot = head;
+    head = (head + 1) & mask;
+    count--;
+    return scanner.unpack(ring[slot], values[slot]);
+}
+
+Token TokenStream::peek(size_t distance) {
+    if (distance >= count) refill();
+    if (distance >= count) return endOfFile();
+    const size_t slot = (head + distance) & mask;
+    return scanner.unpack(ring[slot], values[slot]);
+}
+
+void TokenStream::drain() {
+    while (!exhausted) {
+        count = 0;
+        refill();
+    }
+    count = 0;
+}
+
+void TokenStream::reset() {
+    head = 0;
+    count = 0;
+    exhausted = false;
+}
+
+Token TokenStream::endOfFile() const {
+    return {TokenType::END_OF_FILE, "", scanner.getLineCount(), scanner.getLineCount()};
+}
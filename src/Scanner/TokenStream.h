@@ -0,0 +1,119 @@
+/**
+ * @file TokenStream.h
+ * @brief Pull-based token stream over a Scanner with a bounded lookahead window.
+ *
+ * Tokens are scanned on demand in small batches into a fixed-size ring buffer
+ * of PackedToken records and handed out as the consumer (usually the Parser)
+ * pulls them, so memory use does not grow with the size of the source. The
+ * symbol and literal value of each token are kept alongside, so handing a
+ * token out, or peeking at it again, does not intern or decode it twice. Every
+ * scanned token can also be copied to an optional TokenSink, which is how the
+ * .outlextokens and .outlexerrors files are written.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#ifndef TOKENSTREAM_H
+#define TOKENSTREAM_H
+
+#include <cstddef>
+#include <vector>
+#include "Scanner.h"
+
+/**
+ * @class TokenSink
+ * @brief Receives every token of a stream, in source order.
+ */
+class TokenSink {
+public:
+    virtual ~TokenSink() = default;
+
+    /**
+     * @brief Receives the next token (never END_OF_FILE).
+     */
+    virtual void write(const Token& token) = 0;
+
+    /**
+     * @brief Called once after the last token has been written.
+     */
+    virtual void finish() {}
+};
+
+/**
+ * @class TokenStream
+ * @brief Ring buffer of lookahead tokens refilled from a Scanner.
+ */
+class TokenStream {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 64; ///< Default lookahead window (tokens)
+
+    /**
+     * @brief Creates a stream that pulls tokens from the given scanner.
+     * @param scanner The scanner to pull from; it must outlive the stream.
+     * @param capacity Size of the lookahead window, rounded up to a power of two.
+     */
+    explicit TokenStream(Scanner& scanner, size_t capacity = DEFAULT_CAPACITY);
+
+    TokenStream(const TokenStream&) = delete;
+    TokenStream& operator=(const TokenStream&) = delete;
+
+    /**
+     * @brief Copies every scanned token to the given sink.
+     * @param sink The sink, or nullptr to stop copying. Must be set before the
+     *             first token is pulled to see the whole stream.
+     */
+    void setTee(TokenSink* sink) { tee = sink; }
+
+    /**
+     * @brief Consumes and returns the next token of any kind.
+     * @return The token, or END_OF_FILE (repeatedly) once the source is exhausted.
+     */
+    Token next();
+
+    /**
+     * @brief Returns a token ahead of the stream without consuming it.
+     * @param distance How far ahead to look; must be less than the capacity.
+     * @return The token, or END_OF_FILE past the end of the source.
+     */
+    Token peek(size_t distance = 0);
+
+    /**
+     * @brief Consumes the rest of the source so that the tee sees every token.
+     */
+    void drain();
+
+    /**
+     * @brief Discards the buffered tokens so the stream restarts from the scanner's position.
+     *
+     * Used when the scanner has been pointed at a new source.
+     */
+    void reset();
+
+    /**
+     * @brief Retrieves the size of the lookahead window.
+     */
+    size_t getCapacity() const { return ring.size(); }
+
+private:
+    Scanner& scanner;                 ///< Source of the tokens
+    std::vector<PackedToken> ring;    ///< Lookahead window
+    std::vector<TokenValue> values;   ///< Symbol and literal value of each token in the window
+    size_t mask;                      ///< ring.size() - 1
+    size_t head = 0;                  ///< Index of the next token to hand out
+    size_t count = 0;                 ///< Number of buffered tokens
+    bool exhausted = false;           ///< True once the scanner returned END_OF_FILE
+    TokenSink* tee = nullptr;         ///< Optional copy of the stream
+
+    /**
+     * @brief Scans tokens into the free slots of the window.
+     */
+    void refill();
+
+    /**
+     * @brief The token returned past the end of the source.
+     */
+    Token endOfFile() const;
+};
+
+#endif // TOKENSTREAM_H
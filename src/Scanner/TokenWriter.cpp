@@ -0,0 +1,91 @@
+/**
+ * @file TokenWriter.cpp
+ * @brief Implementation of the scanner output file writer.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#include "TokenWriter.h"
+
+TokenWriter::TokenWriter(const std::string& outputBase) {
+    tokenOutput.open(outputBase + ".outlextokens");
+    errorOutput.open(outputBase + ".outlexerrors");
+}
+
+TokenWriter::~TokenWriter() {
+    finish();
+}
+
+/**
+ * @brief Write one token to the token output, and to the error output if it is an error.
+ */
+void TokenWriter::write(const Token& token) {
+    if (isErrorType(token.kind)) {
+        reportError(token);
+    }
+
+    // Format the token output; newlines inside block comments are written escaped
+    std::string lexeme;
+    if (token.kind == TokenType::BLOCK_COMMENT) {
+        lexeme.reserve(token.lexeme.size());
+        for (char c : token.lexeme) {
+            if (c == '\n') lexeme += "\\n";
+            else lexeme += c;
+        }
+    } else {
+        lexeme = token.lexeme;
+    }
+    std::string tokenStr = "[" + std::string(token.type) + ", " + lexeme + ", " + std::to_string(token.line) + "]";
+    
+    // Check if the current token's line is greater than the last line + 1
+    if (lastLine != -1 && token.line > lastLine + 3) {
+        // If there is a gap between the last token's line and the current token's line,
+        // output the current line of tokens and add empty lines for the gap.
+        tokenOutput << currentOutput << "\n";
+        tokenOutput << "\n";
+        // Start a new line with the current token.
+        currentOutput = tokenStr;
+    } else if (!currentOutput.empty() && token.line != lastLine) {
+        // If the current token is on a new line, output the current line of tokens.
+        tokenOutput << currentOutput << "\n";
+        // Start a new line with the current token.
+        currentOutput = tokenStr;
+    } else {
+        // If the current token is on the same line, append it to the current line of tokens.
+        if (!currentOutput.empty()) {
+            currentOutput += " ";
+        }
+        currentOutput += tokenStr;
+    }
+    // Update the last processed line number.
+    lastLine = token.endLine;
+}
+
+/**
+ * @brief Output the remaining tokens.
+ */
+void TokenWriter::finish() {
+    if (!currentOutput.empty()) {
+        tokenOutput << currentOutput << "\n";
+        currentOutput.clear();
+    }
+    tokenOutput.flush();
+}
+
+/**
+ * @brief Report lexical errors to the error output stream.
+ * 
+ * @param token The erroneous token.
+ */
+void TokenWriter::reportError(const Token& token) {
+    std::string niceMessage;
+    switch (token.kind) {
+        case TokenType::INVALID_ID:   niceMessage = "Invalid identifier"; break;
+        case TokenType::INVALID_LIT:  niceMessage = "Invalid literal"; break;
+        case TokenType::INVALID_CHAR: niceMessage = "Invalid character"; break;
+        default:                      niceMessage = "Unknown error"; break;
+    }
+
+    errorOutput << "Lexical error: " << niceMessage << ": \"" << token.lexeme << "\": line " << token.line << "." << std::endl;
+}
@@ -0,0 +1,52 @@
+/**
+ * @file TokenWriter.h
+ * @brief Writes the .outlextokens and .outlexerrors files from a token stream.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#ifndef TOKENWRITER_H
+#define TOKENWRITER_H
+
+#include <fstream>
+#include <string>
+#include "TokenStream.h"
+
+/**
+ * @class TokenWriter
+ * @brief TokenSink that formats tokens and lexical errors into the scanner output files.
+ *
+ * Tokens are grouped one source line per output line, with a blank line
+ * wherever the source skips more than a few lines.
+ */
+class TokenWriter : public TokenSink {
+public:
+    /**
+     * @brief Opens <outputBase>.outlextokens and <outputBase>.outlexerrors.
+     * @param outputBase The output file path without extension.
+     */
+    explicit TokenWriter(const std::string& outputBase);
+
+    /**
+     * @brief Flushes the pending output line if finish() was not called.
+     */
+    ~TokenWriter() override;
+
+    void write(const Token& token) override;
+    void finish() override;
+
+private:
+    std::ofstream tokenOutput;   ///< Output file stream for tokens
+    std::ofstream errorOutput;   ///< Output file stream for errors
+    std::string currentOutput;   ///< Tokens of the output line being built
+    int lastLine = -1;           ///< End line of the last written token
+
+    /**
+     * @brief Reports a lexical error to the error output stream.
+     * @param token The erroneous token.
+     */
+    void reportError(const Token& token);
+};
+
+#endif // TOKENWRITER_H
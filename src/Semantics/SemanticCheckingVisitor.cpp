@@ -272,9 +272,10 @@ std::shared_ptr<Symbol> SemanticCheckingVisitor::lookupFunctionCaseInsensitive(c
 // Identifier visitor - for checking identifiers
 void SemanticCheckingVisitor::visitIdentifier(ASTNode* node) {
     std::string idName = node->getNodeValue();
+    SymbolId id = node->getSymbolId();
     
     // First look for identifier in current function scope
-    auto symbol = currentTable->lookupSymbol(idName);
+    auto symbol = currentTable->lookupSymbol(id, idName);
     
     // If not found in function scope but we're in a class implementation,
     // check for class members (implicit self access)
@@ -282,7 +283,7 @@ void SemanticCheckingVisitor::visitIdentifier(ASTNode* node) {
         auto classTable = globalTable->getNestedTable(currentClassName);
         if (classTable) {
             // Look for the member in this class
-            symbol = classTable->lookupSymbol(idName);
+            symbol = classTable->lookupSymbol(id, idName);
             
             // If not found, check parent classes for inherited members
             if (!symbol) {
@@ -292,7 +293,7 @@ void SemanticCheckingVisitor::visitIdentifier(ASTNode* node) {
                     for (const auto& parentClass : inheritedClasses) {
                         auto parentTable = globalTable->getNestedTable(parentClass);
                         if (parentTable) {
-                            symbol = parentTable->lookupSymbol(idName);
+                            symbol = parentTable->lookupSymbol(id, idName);
                             if (symbol) break;
                         }
                     }
@@ -1508,15 +1509,10 @@ void SemanticCheckingVisitor::visitType(ASTNode* node) {
 
 void SemanticCheckingVisitor::visitArrayDimension(ASTNode* node) {
     // Store array dimension
-    try {
-        if (node->getNodeValue() == "dynamic") {
-            currentArrayDimensions.push_back(-1);
-        } else {
-            int dim = std::stoi(node->getNodeValue());
-            currentArrayDimensions.push_back(dim);
-        }
-    } catch (const std::exception&) {
-        reportError("Invalid array dimension: " + node->getNodeValue(), node);
+    if (node->getNodeValue() == "dynamic") {
+        currentArrayDimensions.push_back(-1);
+    } else {
+        currentArrayDimensions.push_back(node->getLiteral().intValue);
     }
 }
 
@@ -1779,6 +1775,9 @@ void SemanticCheckingVisitor::reportError(const std::string& message, ASTNode* n
     
     semanticErrors.push_back(error);
     std::cerr << "Error at line " << error.line << ": " << message << std::endl;
+    if (lineIndex) {
+        std::cerr << lineIndex->formatSnippet(error.line);
+    }
 }
 
 void SemanticCheckingVisitor::reportWarning(const std::string& message, ASTNode* node) {
@@ -1983,6 +1982,9 @@ void SemanticCheckingVisitor::reportError(const std::string& message, int line)
     
     std::cerr << "Error" << (line > 0 ? " at line " + std::to_string(line) : "") 
               << ": " << message << std::endl;
+    if (lineIndex) {
+        std::cerr << lineIndex->formatSnippet(line);
+    }
 }
 
 // Add a method to report warnings with explicit line numbers
@@ -111,6 +111,12 @@ public:
      */
     void importSymbolTableErrors(const SymbolTableVisitor& symbolTableVisitor);
 
+    /**
+     * @brief Sets the line index used to quote source lines in error messages
+     * @param index Line index of the source the AST was built from
+     */
+    void setLineIndex(std::shared_ptr<const LineIndex> index) { lineIndex = std::move(index); }
+
 private:
     
     std::shared_ptr<SymbolTable> globalTable;
@@ -126,6 +132,7 @@ private:
     
     // Modified error and warning tracking to include location information
     std::vector<SemanticError> semanticErrors;
+    std::shared_ptr<const LineIndex> lineIndex; // Source lines for error snippets, if known
     
     // Helper methods
     TypeInfo getVariableType(const std::string& name);
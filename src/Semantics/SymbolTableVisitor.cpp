@@ -60,20 +60,28 @@ Symbol::Symbol(const Symbol& other)
 }
 // SymbolTable implementation
 SymbolTable::SymbolTable(const std::string& scopeName, SymbolTable* parent)
-    : scopeName(scopeName), parent(parent) {}
+    : scopeName(scopeName), parent(parent) {
+    if (parent) {
+        interner = parent->interner;
+        ownInterner = parent->ownInterner;
+    } else {
+        setInterner(nullptr);
+    }
+}
 
 // Deep copy constructor implementation
 SymbolTable::SymbolTable(const SymbolTable& other)
     : scopeName(other.scopeName), 
       parent(other.parent),
+      interner(other.interner),
+      ownInterner(other.ownInterner),
       symbolInsertionOrder(other.symbolInsertionOrder),
       metadata(other.metadata),
       nestedTableInsertionOrder(other.nestedTableInsertionOrder)
 {
     // Deep copy all symbols
-    for (const auto& [name, symbol] : other.symbols) {
-        auto symbolCopy = std::make_shared<Symbol>(*symbol); // Copy the Symbol object
-        symbols[name] = symbolCopy;
+    for (const auto& [id, symbol] : other.symbols) {
+        symbols[id] = std::make_shared<Symbol>(*symbol); // Copy the Symbol object
     }
     
     // Deep copy the function symbol if it exists
@@ -84,7 +92,7 @@ SymbolTable::SymbolTable(const SymbolTable& other)
     // Deep copy the functions map
     for (const auto& [sig, symbol] : other.functions) {
         // Find the corresponding symbol in our new symbols map
-        auto it = symbols.find(symbol->getName());
+        auto it = symbols.find(interner->find(symbol->getName()));
         if (it != symbols.end()) {
             functions[sig] = it->second;
         } else {
@@ -103,6 +111,7 @@ SymbolTable::SymbolTable(const SymbolTable& other)
     
 bool SymbolTable::addSymbol(std::shared_ptr<Symbol> symbol) {
     const std::string& name = symbol->getName();
+    SymbolId id = interner->intern(name);
     
     // Special case for functions to allow overloading
     if (symbol->getKind() == SymbolKind::FUNCTION) {
@@ -120,30 +129,32 @@ bool SymbolTable::addSymbol(std::shared_ptr<Symbol> symbol) {
         
         // For functions, we allow multiple with the same name (overloading)
         // Replace in the symbols map or add if not exists
-        symbols[name] = symbol;
-        
-        // Track insertion order
-        if (std::find(symbolInsertionOrder.begin(), symbolInsertionOrder.end(), name) == symbolInsertionOrder.end()) {
-            symbolInsertionOrder.push_back(name);
+        if (symbols.insert_or_assign(id, symbol).second) {
+            // Track insertion order
+            symbolInsertionOrder.push_back(id);
         }
         
         return true;
     }
     
-    // For non-functions, check if the name already exists
-    if (symbols.find(name) != symbols.end()) {
+    // For non-functions, the name must not exist yet
+    if (!symbols.emplace(id, symbol).second) {
         return false; // Symbol already exists
     }
     
-    // Add to symbols map
-    symbols[name] = symbol;
     // Track insertion order
-    symbolInsertionOrder.push_back(name);
+    symbolInsertionOrder.push_back(id);
     return true;
 }
 
 std::shared_ptr<Symbol> SymbolTable::lookupSymbol(const std::string& name, bool localOnly) {
-    auto it = symbols.find(name);
+    // Hash the spelling once; the scope chain is then searched by ID.
+    SymbolId id = interner->find(name);
+    return id == NO_SYMBOL ? nullptr : lookupSymbol(id, localOnly);
+}
+
+std::shared_ptr<Symbol> SymbolTable::lookupSymbol(SymbolId id, bool localOnly) {
+    auto it = symbols.find(id);
     if (it != symbols.end()) {
         return it->second;
     }
@@ -152,7 +163,39 @@ std::shared_ptr<Symbol> SymbolTable::lookupSymbol(const std::string& name, bool
         return nullptr;
     }
     
-    return parent->lookupSymbol(name);
+    return parent->lookupSymbol(id);
+}
+
+std::shared_ptr<Symbol> SymbolTable::lookupSymbol(SymbolId id, const std::string& name, bool localOnly) {
+    // IDs in the AST come from the session's interner, not from a private one
+    if (!ownInterner && id != NO_SYMBOL) {
+        return lookupSymbol(id, localOnly);
+    }
+    return lookupSymbol(name, localOnly);
+}
+
+void SymbolTable::setInterner(StringInterner* interner) {
+    std::vector<std::shared_ptr<Symbol>> ordered;
+    for (SymbolId id : symbolInsertionOrder) {
+        ordered.push_back(symbols.at(id));
+    }
+
+    if (interner) {
+        ownInterner.reset();
+        this->interner = interner;
+    } else {
+        ownInterner = std::make_shared<StringInterner>();
+        this->interner = ownInterner.get();
+    }
+
+    // Re-key the symbols added so far under the new interner
+    symbols.clear();
+    symbolInsertionOrder.clear();
+    for (const auto& symbol : ordered) {
+        SymbolId id = this->interner->intern(symbol->getName());
+        symbols[id] = symbol;
+        symbolInsertionOrder.push_back(id);
+    }
 }
 
 std::shared_ptr<Symbol> SymbolTable::lookupFunction(const FunctionSignature& signature, bool localOnly) {
@@ -208,9 +251,28 @@ std::vector<std::pair<FunctionSignature, std::shared_ptr<Symbol>>> SymbolTable::
     return result;
 }
 
+std::vector<std::pair<std::string, std::shared_ptr<Symbol>>> SymbolTable::getSymbols() const {
+    std::vector<std::pair<std::string, std::shared_ptr<Symbol>>> orderedSymbols;
+    orderedSymbols.reserve(symbolInsertionOrder.size());
+    for (auto it = symbolInsertionOrder.rbegin(); it != symbolInsertionOrder.rend(); ++it) {
+        orderedSymbols.emplace_back(std::string(interner->lookup(*it)), symbols.at(*it));
+    }
+    return orderedSymbols;
+}
+
+std::vector<std::string> SymbolTable::getSymbolInsertionOrder() const {
+    std::vector<std::string> names;
+    names.reserve(symbolInsertionOrder.size());
+    for (SymbolId id : symbolInsertionOrder) {
+        names.emplace_back(interner->lookup(id));
+    }
+    return names;
+}
+
 bool SymbolTable::removeSymbol(const std::string& name) {
     // First check if the symbol exists
-    auto it = symbols.find(name);
+    SymbolId id = interner->find(name);
+    auto it = symbols.find(id);
     if (it == symbols.end()) {
         return false; // Symbol not found
     }
@@ -219,7 +281,7 @@ bool SymbolTable::removeSymbol(const std::string& name) {
     symbols.erase(it);
     
     // Remove from the insertion order vector
-    auto orderIt = std::find(symbolInsertionOrder.begin(), symbolInsertionOrder.end(), name);
+    auto orderIt = std::find(symbolInsertionOrder.begin(), symbolInsertionOrder.end(), id);
     if (orderIt != symbolInsertionOrder.end()) {
         symbolInsertionOrder.erase(orderIt);
     }
@@ -238,16 +300,16 @@ SymbolTableVisitor::~SymbolTableVisitor() {
 
 // Implement updated error reporting methods
 void SymbolTableVisitor::reportError(const std::string& message, ASTNode* node) {
-    int line = node ? node->getLineNumber() : 0;
-    errors.push_back({("SymTab Error: " + message), line});
-    std::cerr << " SymTab Error" << (line > 0 ? " at line " + std::to_string(line) : "") 
-              << ": " << message << std::endl;
+    reportError(message, node ? node->getLineNumber() : 0);
 }
 
 void SymbolTableVisitor::reportError(const std::string& message, int line) {
     errors.push_back({("SymTab Error: " + message), line});
     std::cerr << " SymTab Error" << (line > 0 ? " at line " + std::to_string(line) : "") 
               << ": " << message << std::endl;
+    if (lineIndex) {
+        std::cerr << lineIndex->formatSnippet(line);
+    }
 }
 
 void SymbolTableVisitor::reportWarning(const std::string& message, ASTNode* node) {
@@ -266,6 +328,7 @@ void SymbolTableVisitor::reportWarning(const std::string& message, int line) {
 void SymbolTableVisitor::visitProgram(ASTNode* node) {
     // Create global table
     globalTable = std::make_shared<SymbolTable>("global");
+    globalTable->setInterner(interner);
     currentTable = globalTable;
     
     // Visit all children of the program node
@@ -910,17 +973,12 @@ void SymbolTableVisitor::visitArrayDimension(ASTNode* node) {
         return;
     }
     
-    // For regular arrays with dimension values stored directly in the node
-    try {
-        int dimension = std::stoi(dimensionValue);
-        if (dimension <= 0) {
-            reportError("Array dimension must be positive.", node);
-        } else {
-            currentArrayDimensions.push_back(dimension);
-        }
-    } catch (const std::exception&) {
-        reportError("Invalid array dimension: " + dimensionValue, node);
-        currentArrayDimensions.push_back(-1);  // Default to dynamic
+    // For regular arrays, the scanner decoded the dimension literal
+    int dimension = node->getLiteral().intValue;
+    if (dimension <= 0) {
+        reportError("Array dimension must be positive.", node);
+    } else {
+        currentArrayDimensions.push_back(dimension);
     }
 }
 
@@ -2,6 +2,8 @@
 #define SYMBOL_TABLE_VISITOR_H
 
 #include "Visitor.h"
+#include "Scanner/LineIndex.h"
+#include "Scanner/StringInterner.h"
 #include <unordered_map>
 #include <vector>
 #include <string>
@@ -179,6 +181,16 @@ public:
 
     // Lookup a symbol in this table (or parent tables if not found)
     std::shared_ptr<Symbol> lookupSymbol(const std::string& name, bool localOnly = false);
+
+    // Lookup a symbol by interned name
+    std::shared_ptr<Symbol> lookupSymbol(SymbolId id, bool localOnly = false);
+
+    // Lookup by interned name when the ID comes from this table's interner, by spelling otherwise
+    std::shared_ptr<Symbol> lookupSymbol(SymbolId id, const std::string& name, bool localOnly = false);
+
+    // Set the interner symbol names are indexed with (a private one if nullptr); nested tables created later inherit it
+    void setInterner(StringInterner* interner);
+    StringInterner* getInterner() const { return interner; }
     
     // Lookup a function with specific signature
     std::shared_ptr<Symbol> lookupFunction(const FunctionSignature& signature, bool localOnly = false);
@@ -192,8 +204,8 @@ public:
     // Get a nested table
     std::shared_ptr<SymbolTable> getNestedTable(const std::string& name);
     
-    // Get all symbols in this table
-    const std::unordered_map<std::string, std::shared_ptr<Symbol>>& getSymbols() const { return symbols; }
+    // Get all symbols in this table, most recently added first
+    std::vector<std::pair<std::string, std::shared_ptr<Symbol>>> getSymbols() const;
     
     // Get all nested tables
     const std::unordered_map<std::string, std::shared_ptr<SymbolTable>>& getNestedTables() const { return nestedTables; }
@@ -224,20 +236,7 @@ public:
         return ""; // Return empty string if key not found
     }
 
-    std::vector<std::pair<std::string, std::shared_ptr<Symbol>>> getSymbolsInOrder() const {
-        std::vector<std::pair<std::string, std::shared_ptr<Symbol>>> orderedSymbols;
-        for (const auto& name : symbolInsertionOrder) {
-            auto it = symbols.find(name);
-            if (it != symbols.end()) {
-                orderedSymbols.push_back(*it);
-            }
-        }
-        return orderedSymbols;
-    }
-
-    const std::vector<std::string>& getSymbolInsertionOrder() const {
-        return symbolInsertionOrder;
-    }
+    std::vector<std::string> getSymbolInsertionOrder() const;
     const std::vector<std::string>& getNestedTableInsertionOrder() const {
         return nestedTableInsertionOrder;
     }
@@ -245,12 +244,14 @@ public:
 private:
     std::string scopeName;
     SymbolTable* parent;
-    std::unordered_map<std::string, std::shared_ptr<Symbol>> symbols;
+    std::unordered_map<SymbolId, std::shared_ptr<Symbol>> symbols; // Keyed by interned name
+    StringInterner* interner = nullptr; // Interner of the compilation session, or ownInterner
+    std::shared_ptr<StringInterner> ownInterner; // Interner of tables built without a session
     std::unordered_map<std::string, std::shared_ptr<SymbolTable>> nestedTables;
     std::unordered_map<FunctionSignature, std::shared_ptr<Symbol>> functions;
     std::shared_ptr<Symbol> functionSymbol = nullptr;  // For function tables
     std::unordered_map<std::string, std::string> metadata;
-    std::vector<std::string> symbolInsertionOrder; // To maintain insertion order
+    std::vector<SymbolId> symbolInsertionOrder; // To maintain insertion order
     std::vector<std::string> nestedTableInsertionOrder; // For nested tables
 };
 
@@ -343,6 +344,18 @@ public:
      */
     const std::vector<ErrorInfo>& getWarnings() const { return warnings; }
 
+    /**
+     * @brief Sets the line index used to quote source lines in error messages
+     * @param index Line index of the source the AST was built from
+     */
+    void setLineIndex(std::shared_ptr<const LineIndex> index) { lineIndex = std::move(index); }
+
+    /**
+     * @brief Sets the interner the symbol tables index names with
+     * @param interner Interner of the compilation session the AST was parsed in
+     */
+    void setInterner(StringInterner* interner) { this->interner = interner; }
+
 private:
     // Helper methods
     void reportError(const std::string& message, ASTNode* node);
@@ -376,6 +389,8 @@ private:
     
     std::vector<ErrorInfo> errors;
     std::vector<ErrorInfo> warnings;
+    std::shared_ptr<const LineIndex> lineIndex; // Source lines for error snippets, if known
+    StringInterner* interner = nullptr;         // Interner for symbol table names (not owned)
 
     std::string formatTypeWithDimensions(const std::shared_ptr<Symbol>& symbol) const;
 
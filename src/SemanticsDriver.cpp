@@ -1,6 +1,7 @@
 #include "Semantics/SymbolTableVisitor.h"
 #include "Semantics/SemanticCheckingVisitor.h"
 #include "Parser/Parser.h"
+#include "Session/CompilationSession.h"
 #include <iostream>
 #include <string>
 #include <vector>
@@ -11,7 +12,7 @@ namespace fs = std::filesystem;
 void printUsage(const std::string& programName) {
     std::cout << "Usage: " << programName << " [options] file1 [file2 ...]\n"
               << "Options:\n"
-              << "  -t, --table <csv_file>   Specify a custom parsing table CSV file. Default is 'attribute_grammar_parsing_table.csv'.\n"
+              << "  -t, --table <csv_file>   Specify a custom parsing table CSV file. Default is the built-in attribute grammar table.\n"
               << "  -o, --output <dir>       Specify output directory for symbol tables. Default is current directory.\n"
               << "  -h, --help               Show this help message.\n";
 }
@@ -22,7 +23,7 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    std::string tableFile = "attribute_grammar_parsing_table.csv";
+    std::string tableFile; // Empty: the attribute grammar table compiled into the program
     std::string outputDir = ".";
     std::vector<std::string> inputFiles;
 
@@ -65,12 +66,18 @@ int main(int argc, char* argv[]) {
         fs::create_directories(outputDir);
     }
 
+    // Load the table once; every parser below shares it.
+    std::shared_ptr<const ParsingTable> table = Parser::loadTable(tableFile);
+
     for (const auto& file : inputFiles) {
         std::cout << "Processing file: " << file << std::endl;
         
         // First parse the file to generate AST
-        std::cout << "Parsing file: " << file << " with table: " << tableFile << std::endl;
-        Parser parser(file, tableFile);
+        std::cout << "Parsing file: " << file << " with table: " << (tableFile.empty() ? "built-in" : tableFile) << std::endl;
+        CompilationSession session;
+        Parser parser(file, table, Scanner(file));
+        parser.setInterner(&session.getInterner());
+        parser.setArena(&session.getArena());
         
         bool parseSuccess = parser.parse();
         if (!parseSuccess) {
@@ -85,6 +92,8 @@ int main(int argc, char* argv[]) {
         // Phase 1: Symbol Table Generation
         std::cout << "Generating symbol table..." << std::endl;
         SymbolTableVisitor symbolTableVisitor;
+        symbolTableVisitor.setLineIndex(parser.getLineIndex());
+        symbolTableVisitor.setInterner(&session.getInterner());
         root->accept(&symbolTableVisitor);
         
         // Output the symbol table to file
@@ -95,6 +104,7 @@ int main(int argc, char* argv[]) {
         // Phase 2: Semantic Checking
         std::cout << "Performing semantic checking..." << std::endl;
         SemanticCheckingVisitor semanticChecker(symbolTableVisitor.getGlobalTable());
+        semanticChecker.setLineIndex(parser.getLineIndex());
 
         // Import errors from the symbol table visitor
         semanticChecker.importSymbolTableErrors(symbolTableVisitor);
@@ -0,0 +1,48 @@
+/**
+ * @file CompilationSession.h
+ * @brief State shared by every phase of one compilation.
+ *
+ * A session lives for the whole compilation of one source file. The phases
+ * borrow what they need from it: the scanner and the symbol tables share its
+ * string interner, so an identifier gets the same ID from scanning through
+ * code generation, and the parser builds the AST in its arena, so the tree
+ * lives until the end of the compilation and is then freed at once.
+ *
+ * @author @TheBarzani
+ * @date 2026-10-17
+ */
+
+#ifndef COMPILATIONSESSION_H
+#define COMPILATIONSESSION_H
+
+#include "ASTGenerator/ASTArena.h"
+#include "Scanner/StringInterner.h"
+
+/**
+ * @class CompilationSession
+ * @brief Owns the data that outlives individual compiler phases.
+ */
+class CompilationSession {
+public:
+    CompilationSession() = default;
+    CompilationSession(const CompilationSession&) = delete;
+    CompilationSession& operator=(const CompilationSession&) = delete;
+
+    /**
+     * @brief Retrieves the interner identifiers are interned into.
+     * @return The session's interner.
+     */
+    StringInterner& getInterner() { return interner; }
+
+    /**
+     * @brief Retrieves the arena the AST is allocated from.
+     * @return The session's arena.
+     */
+    ASTArena& getArena() { return arena; }
+
+private:
+    StringInterner interner; ///< Identifier spellings of the compilation
+    ASTArena arena;          ///< Nodes of the AST
+};
+
+#endif // COMPILATIONSESSION_H
@@ -1,22 +1,29 @@
 #include "Scanner/Scanner.h"
+#include "Scanner/Lexicon.h"
+#include "Scanner/CharScan.h"
+#include "Scanner/TokenStream.h"
+#include "Scanner/TokenPipeline.h"
+#include "Scanner/ParallelLexer.h"
+#include "Scanner/IncrementalLexer.h"
+#include "Scanner/LineIndex.h"
+#include "Scanner/StringInterner.h"
+#include "Parser/ParsingTable.h"
+#include "Parser/AttributeGrammarTable.h"
+#include "Parser/Parser.h"
+#include "ASTGenerator/ASTArena.h"
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
 #include <fstream>
+#include <sstream>
 #include <string>
-
-// Helper function to create a temporary file with given content
-std::string createTempFile(const std::string& content) {
-    std::string filename = "temp_test_file.src";
-    std::ofstream file(filename);
-    file << content;
-    file.close();
-    return filename;
-}
+#include <thread>
 
 // Test scanning identifiers and keywords
 TEST(ScannerTest, IdentifiersAndKeywords) {
     std::string content = "int main void class";
-    std::string filename = createTempFile(content);
-    Scanner scanner(filename);
+    Scanner scanner = Scanner::fromText(content);
 
     Token token = scanner.getNextToken();
     EXPECT_EQ(token.type, "int");
@@ -41,8 +48,7 @@ TEST(ScannerTest, IdentifiersAndKeywords) {
 // Test scanning numbers
 TEST(ScannerTest, Numbers) {
     std::string content = "123 45.67 89e10 3.14e-2";
-    std::string filename = createTempFile(content);
-    Scanner scanner(filename);
+    Scanner scanner = Scanner::fromText(content);
 
     Token token = scanner.getNextToken();
     EXPECT_EQ(token.type, "intnum");
@@ -67,8 +73,7 @@ TEST(ScannerTest, Numbers) {
 // Test scanning operators and punctuation
 TEST(ScannerTest, OperatorsAndPunctuation) {
     std::string content = "+ - * / == <= >= ( ) { }";
-    std::string filename = createTempFile(content);
-    Scanner scanner(filename);
+    Scanner scanner = Scanner::fromText(content);
 
     Token token = scanner.getNextToken();
     EXPECT_EQ(token.type, "plus");
@@ -121,8 +126,7 @@ TEST(ScannerTest, OperatorsAndPunctuation) {
 // Test scanning comments
 TEST(ScannerTest, Comments) {
     std::string content = "// This is an inline comment\n/* This is a block comment */";
-    std::string filename = createTempFile(content);
-    Scanner scanner(filename);
+    Scanner scanner = Scanner::fromText(content);
 
     Token token = scanner.getNextToken();
     EXPECT_EQ(token.type, "inlinecmt");
@@ -139,8 +143,7 @@ TEST(ScannerTest, Comments) {
 // Test scanning invalid tokens
 TEST(ScannerTest, InvalidTokens) {
     std::string content = "@ # $";
-    std::string filename = createTempFile(content);
-    Scanner scanner(filename);
+    Scanner scanner = Scanner::fromText(content);
 
     Token token = scanner.getNextToken();
     EXPECT_EQ(token.type, "invalidchar");
@@ -173,8 +176,7 @@ TEST(ScannerTest, InvalidNumbers) {
         0x1A         // Invalid: hexadecimal notation (not allowed)
         1_000        // Invalid: underscore in number
     )";
-    std::string filename = createTempFile(content);
-    Scanner scanner(filename);
+    Scanner scanner = Scanner::fromText(content);
 
     Token token = scanner.getNextToken();
     scanner.getNextToken(); // Skip the comment
@@ -255,8 +257,7 @@ TEST(ScannerTest, InvalidOperators) {
         // Invalid operator: !
         !3;
     )";
-    std::string filename = createTempFile(content);
-    Scanner scanner(filename);
+    Scanner scanner = Scanner::fromText(content);
     
     scanner.getNextToken(); // Skip the comment
     Token token = scanner.getNextToken();
@@ -390,6 +391,941 @@ TEST(ScannerTest, InvalidOperators) {
     EXPECT_EQ(token.type, "eof");
 }
 
+// Test that the LexerDFA transition table and the hand-written branches agree
+TEST(ScannerTest, TransitionTableMatchesBranches) {
+    std::string content =
+        "_abc a_1 1abc 0123 1.0 1.00 1.230e+05 1e 1.e2 12.3e-0 3.14e-2.\n"
+        "== <> <= >= => := : < > = ! @ // inline\n"
+        "/* outer /* nested */ still */ x /* unterminated";
+    Scanner tableScanner = Scanner::fromText(content);
+    Scanner branchScanner = Scanner::fromText(content);
+    tableScanner.setUseTransitionTable(true);
+    branchScanner.setUseTransitionTable(false);
+
+    Token expected;
+    Token actual;
+    do {
+        expected = branchScanner.getNextToken();
+        actual = tableScanner.getNextToken();
+        EXPECT_EQ(actual.kind, expected.kind);
+        EXPECT_EQ(actual.lexeme, expected.lexeme);
+        EXPECT_EQ(actual.line, expected.line);
+        EXPECT_EQ(actual.endLine, expected.endLine);
+    } while (expected.kind != TokenType::END_OF_FILE);
+}
+
+// Test that every reserved word is recognised and near misses stay identifiers
+TEST(ScannerTest, ReservedWordLookup) {
+    for (const auto& word : Lexicon::reservedWords) {
+        EXPECT_EQ(Lexicon::reservedWordType(word.text), word.type);
+    }
+    for (const char* word : {"i", "in", "integer", "Int", "floats", "whil", "implementations", "nota", "x"}) {
+        EXPECT_EQ(Lexicon::reservedWordType(word), TokenType::ID);
+    }
+}
+
+// Test that every CharScan SIMD level agrees with the scalar kernels
+TEST(ScannerTest, CharScanLevelsAgree) {
+    std::string text;
+    for (int i = 0; i < 200; ++i) {
+        text += std::string(i % 37, ' ') + "\t\n" + std::string(i % 41, 'a') + "_9/" + std::string(i % 23, 'x') + "*\n";
+    }
+    const char* begin = text.data();
+    const char* end = begin + text.size();
+
+    CharScan::SimdLevel best = CharScan::detectedLevel();
+    for (int level = 0; level <= static_cast<int>(best); ++level) {
+        for (size_t offset = 0; offset < text.size(); offset += 7) {
+            const char* p = begin + offset;
+            CharScan::setLevel(CharScan::SimdLevel::SCALAR);
+            const char* whitespace = CharScan::skipWhitespace(p, end);
+            const char* identifier = CharScan::skipIdentifierChars(p, end);
+            const char* delimiter = CharScan::findCommentDelimiter(p, end);
+            const char* newline = CharScan::findNewline(p, end);
+            size_t newlines = CharScan::countNewlines(p, end);
+
+            CharScan::setLevel(static_cast<CharScan::SimdLevel>(level));
+            EXPECT_EQ(CharScan::skipWhitespace(p, end), whitespace);
+            EXPECT_EQ(CharScan::skipIdentifierChars(p, end), identifier);
+            EXPECT_EQ(CharScan::findCommentDelimiter(p, end), delimiter);
+            EXPECT_EQ(CharScan::findNewline(p, end), newline);
+            EXPECT_EQ(CharScan::countNewlines(p, end), newlines);
+        }
+    }
+    CharScan::setLevel(best);
+}
+
+// Test that a small token window yields the scanner's tokens and tees all of them
+TEST(ScannerTest, TokenStreamWindow) {
+    struct CountingSink : TokenSink {
+        int written = 0;
+        bool finished = false;
+        void write(const Token&) override { written++; }
+        void finish() override { finished = true; }
+    };
+
+    std::string content = "a := b + 1; // comment\n/* block\n */ while (c <> 2.5) { @ }";
+    Scanner expectedScanner = Scanner::fromText(content);
+    Scanner streamedScanner = Scanner::fromText(content);
+    StringInterner expectedInterner, streamedInterner;
+    expectedScanner.setInterner(&expectedInterner);
+    streamedScanner.setInterner(&streamedInterner);
+    TokenStream stream(streamedScanner, 3);
+    CountingSink sink;
+    stream.setTee(&sink);
+    EXPECT_EQ(stream.getCapacity(), 4u);
+
+    int count = 0;
+    Token expected;
+    do {
+        expected = expectedScanner.getNextToken();
+        Token ahead = stream.peek(2);
+        Token actual = stream.next();
+        EXPECT_EQ(actual.kind, expected.kind);
+        EXPECT_EQ(actual.lexeme, expected.lexeme);
+        EXPECT_EQ(actual.line, expected.line);
+        EXPECT_EQ(actual.symbol, expected.symbol);
+        EXPECT_FLOAT_EQ(actual.literal.floatValue, expected.literal.floatValue);
+        if (ahead.kind != TokenType::END_OF_FILE) {
+            EXPECT_EQ(ahead.lexeme, stream.peek(1).lexeme);
+        }
+        if (expected.kind != TokenType::END_OF_FILE) count++;
+    } while (expected.kind != TokenType::END_OF_FILE);
+
+    EXPECT_EQ(stream.next().kind, TokenType::END_OF_FILE);
+    EXPECT_EQ(sink.written, count);
+    EXPECT_TRUE(sink.finished);
+
+    // Buffered tokens keep the symbol they were scanned with; they are not interned again.
+    Scanner again = Scanner::fromText("x y");
+    again.setInterner(&streamedInterner);
+    TokenStream window(again);
+    const SymbolId x = window.peek().symbol;
+    again.setInterner(nullptr);
+    EXPECT_NE(x, NO_SYMBOL);
+    EXPECT_EQ(window.next().symbol, x);
+    EXPECT_EQ(window.next().symbol, streamedInterner.find("y"));
+}
+
+// Test that the threaded pipeline hands over the scanner's tokens, in order, across many batches
+TEST(ScannerTest, TokenPipelineMatchesScanner) {
+    struct CountingSink : TokenSink {
+        int written = 0;
+        bool finished = false;
+        void write(const Token&) override { written++; }
+        void finish() override { finished = true; }
+    };
+
+    std::string content;
+    for (int i = 0; i < 2000; ++i) {
+        content += "x" + std::to_string(i % 7) + " := " + std::to_string(i) + " * 1.5; /* c */ @\n";
+    }
+    Scanner expectedScanner = Scanner::fromText(content);
+    Scanner pipedScanner = Scanner::fromText(content);
+    StringInterner expectedInterner, pipedInterner;
+    expectedScanner.setInterner(&expectedInterner);
+    pipedScanner.setInterner(&pipedInterner);
+    TokenStream stream(expectedScanner);
+    CountingSink sink;
+    TokenPipeline pipeline(pipedScanner, &sink);
+
+    int count = 0;
+    Token expected;
+    do {
+        expected = stream.next();
+        Token actual = pipeline.next();
+        ASSERT_EQ(actual.kind, expected.kind);
+        EXPECT_EQ(actual.lexeme, expected.lexeme);
+        EXPECT_EQ(actual.line, expected.line);
+        EXPECT_EQ(actual.symbol, expected.symbol);
+        EXPECT_EQ(actual.symbol != NO_SYMBOL, actual.kind == TokenType::ID);
+        EXPECT_EQ(actual.literal.intValue, expected.literal.intValue);
+        if (expected.kind != TokenType::END_OF_FILE) count++;
+    } while (expected.kind != TokenType::END_OF_FILE);
+
+    EXPECT_GT(count, static_cast<int>(TokenPipeline::BATCH_SIZE * TokenPipeline::QUEUE_BATCHES));
+    EXPECT_EQ(pipeline.next().kind, TokenType::END_OF_FILE);
+    pipeline.drain();
+    EXPECT_EQ(sink.written, count);
+    EXPECT_TRUE(sink.finished);
+}
+
+// Test that chunked lexing stitches comments spanning chunks back together
+TEST(ScannerTest, ParallelLexerMatchesSequential) {
+    std::string content;
+    for (int i = 0; i < 40; ++i) {
+        content += "x := " + std::to_string(i) + "; // line /* not a comment\n";
+        content += "/* outer\n /* inner " + std::to_string(i) + "\n */\n still outer */ y;\n";
+        content += i % 7 == 0 ? "/* left open\n" : "_ @ 1.50\n";
+    }
+    auto source = std::make_shared<const SourceBuffer>(content.data(), content.size());
+
+    Scanner scanner(source, "");
+    std::vector<PackedToken> expected;
+    for (Token token = scanner.getNextToken(); token.kind != TokenType::END_OF_FILE; token = scanner.getNextToken()) {
+        expected.push_back(scanner.pack(token));
+    }
+
+    for (size_t chunks : {2, 3, 8, 33, 200}) {
+        ParallelLexer lexer(source, chunks);
+        std::vector<PackedToken> actual = lexer.run();
+        ASSERT_EQ(actual.size(), expected.size()) << chunks << " chunks";
+        for (size_t i = 0; i < actual.size(); ++i) {
+            EXPECT_EQ(actual[i].offset, expected[i].offset);
+            EXPECT_EQ(actual[i].length, expected[i].length);
+            EXPECT_EQ(actual[i].line, expected[i].line);
+            EXPECT_EQ(actual[i].kind, expected[i].kind);
+            EXPECT_EQ(actual[i].endLineDelta, expected[i].endLineDelta);
+        }
+    }
+}
+
+TEST(ScannerTest, IncrementalLexerMatchesFullRelex) {
+    auto lexAll = [](const std::string& text) {
+        Scanner scanner(std::make_shared<const SourceBuffer>(text.data(), text.size()), "");
+        std::vector<PackedToken> tokens;
+        for (Token token = scanner.getNextToken(); token.kind != TokenType::END_OF_FILE; token = scanner.getNextToken()) {
+            tokens.push_back(scanner.pack(token));
+        }
+        return tokens;
+    };
+
+    const std::string before = "x := 1;\nif (x == 2) then y := 3.5e2; // note\n/* block\n comment */ z := x;\nwrite(z);\n";
+    struct Case { size_t offset; size_t removed; std::string text; };
+    const Case cases[] = {
+        {0, 0, "\n"},                    // Shifts every line
+        {5, 1, "42"},                     // Longer literal
+        {8, 0, "/* "},                    // Opens a comment that swallows the next line
+        {11, 2, "<>"},                    // Operator change
+        {before.size(), 0, "return;"},    // Append at the end
+        {0, before.size(), "a"},          // Replace everything
+    };
+    for (const Case& c : cases) {
+        std::string after = before.substr(0, c.offset) + c.text + before.substr(c.offset + c.removed);
+        auto source = std::make_shared<const SourceBuffer>(after.data(), after.size());
+
+        std::vector<PackedToken> tokens = lexAll(before);
+        IncrementalLexer lexer(source);
+        lexer.relex(tokens, {c.offset, c.removed, c.text.size()}).apply(tokens);
+
+        std::vector<PackedToken> expected = lexAll(after);
+        ASSERT_EQ(tokens.size(), expected.size()) << "edit at " << c.offset;
+        for (size_t i = 0; i < tokens.size(); ++i) {
+            EXPECT_EQ(tokens[i].offset, expected[i].offset);
+            EXPECT_EQ(tokens[i].length, expected[i].length);
+            EXPECT_EQ(tokens[i].line, expected[i].line);
+            EXPECT_EQ(tokens[i].kind, expected[i].kind);
+            EXPECT_EQ(tokens[i].endLineDelta, expected[i].endLineDelta);
+        }
+    }
+}
+
+TEST(ScannerTest, LineIndexLookup) {
+    const std::string content = "x := 1;\n\n\tif (y) then\r\nz := /* a\nb */ 2;";
+    auto source = std::make_shared<const SourceBuffer>(content.data(), content.size());
+    LineIndex index(*source);
+
+    ASSERT_EQ(index.getLineCount(), 5);
+    EXPECT_EQ(index.getLineText(1), "x := 1;");
+    EXPECT_EQ(index.getLineText(2), "");
+    EXPECT_EQ(index.getLineText(3), "\tif (y) then");
+    EXPECT_EQ(index.getLineText(5), "b */ 2;");
+    EXPECT_EQ(index.getLineText(6), "");
+    EXPECT_EQ(index.formatSnippet(3, 5), " 3 | \tif (y) then\n   | \t   ^\n");
+
+    // Token positions agree with the lines the scanner reports.
+    Scanner scanner(source, "");
+    for (Token token = scanner.getNextToken(); token.kind != TokenType::END_OF_FILE; token = scanner.getNextToken()) {
+        SourcePosition position = scanner.locate(token);
+        EXPECT_EQ(position.line, token.line) << token.lexeme;
+        size_t offset = static_cast<size_t>(token.lexeme.data() - source->begin());
+        EXPECT_EQ(index.getLineText(position.line)[position.column - 1], content[offset]);
+    }
+}
+
+TEST(ScannerTest, IdentifiersAreInterned) {
+    const std::string content = "count := count + limit; int x; x := limit;";
+    auto source = std::make_shared<const SourceBuffer>(content.data(), content.size());
+    StringInterner interner;
+    Scanner scanner(source, "");
+    scanner.setInterner(&interner);
+    TokenStream stream(scanner);
+
+    std::vector<Token> identifiers;
+    for (Token token = stream.next(); token.kind != TokenType::END_OF_FILE; token = stream.next()) {
+        if (token.kind == TokenType::ID) {
+            identifiers.push_back(token);
+        } else {
+            EXPECT_EQ(token.symbol, NO_SYMBOL) << token.lexeme;
+        }
+    }
+
+    ASSERT_EQ(identifiers.size(), 6u);
+    EXPECT_EQ(interner.size(), 3u);
+    EXPECT_EQ(identifiers[0].symbol, 0u);
+    EXPECT_EQ(identifiers[1].symbol, identifiers[0].symbol);
+    EXPECT_EQ(identifiers[2].symbol, 1u);
+    EXPECT_EQ(identifiers[5].symbol, identifiers[2].symbol);
+    for (const Token& token : identifiers) {
+        EXPECT_EQ(interner.lookup(token.symbol), token.lexeme);
+    }
+    EXPECT_EQ(interner.find("x"), identifiers[3].symbol);
+    EXPECT_EQ(interner.find("missing"), NO_SYMBOL);
+}
+
+TEST(ScannerTest, InMemoryScannerWritesToSink) {
+    struct CollectingSink : TokenSink {
+        std::vector<Token> tokens;
+        bool finished = false;
+        void write(const Token& token) override { tokens.push_back(token); }
+        void finish() override { finished = true; }
+    };
+
+    const std::string content = "x := 1; @\n/* c */ y";
+    CollectingSink sink;
+    Scanner scanner(content.data(), content.size(), &sink);
+    scanner.processFile();
+
+    EXPECT_TRUE(sink.finished);
+    ASSERT_EQ(sink.tokens.size(), 7u);
+    EXPECT_EQ(sink.tokens[0].lexeme, "x");
+    EXPECT_EQ(sink.tokens[4].kind, TokenType::INVALID_CHAR);
+    EXPECT_EQ(sink.tokens[5].kind, TokenType::BLOCK_COMMENT);
+    EXPECT_EQ(sink.tokens[6].line, 2);
+    EXPECT_EQ(scanner.getOutputBase(), "");
+
+    // A scanner made from text keeps it, so its tokens outlive the caller's string.
+    std::string text = "y := 2;";
+    Scanner owning = Scanner::fromText(text);
+    text.assign(text.size(), '#');
+    EXPECT_EQ(owning.getNextToken().lexeme, "y");
+    EXPECT_EQ(owning.getNextToken().lexeme, ":=");
+}
+
+TEST(ScannerTest, LiteralsDecodedAtScanTime) {
+    const std::string content = "42 2147483647 2147483648 1.5e+2 0.25 1.0e-50 1.0e+39 1.0e-400 1.0E-400 1.0E+400";
+    Scanner scanner = Scanner::fromText(content);
+
+    Token small = scanner.getNextToken();
+    ASSERT_EQ(small.kind, TokenType::INTLIT);
+    EXPECT_EQ(small.literal.intValue, 42);
+    Token largest = scanner.getNextToken();
+    ASSERT_EQ(largest.kind, TokenType::INTLIT);
+    EXPECT_EQ(largest.literal.intValue, 2147483647);
+    Token overflow = scanner.getNextToken();
+    EXPECT_EQ(overflow.kind, TokenType::INVALID_LIT);
+    EXPECT_EQ(overflow.lexeme, "2147483648");
+
+    Token exponent = scanner.getNextToken();
+    ASSERT_EQ(exponent.kind, TokenType::FLOATLIT);
+    EXPECT_FLOAT_EQ(exponent.literal.floatValue, 150.0f);
+    Token fraction = scanner.getNextToken();
+    EXPECT_FLOAT_EQ(scanner.unpack(scanner.pack(fraction)).literal.floatValue, 0.25f);
+
+    // Underflow rounds towards zero; overflow is an invalid literal.
+    Token tiny = scanner.getNextToken();
+    ASSERT_EQ(tiny.kind, TokenType::FLOATLIT);
+    EXPECT_EQ(tiny.literal.floatValue, 0.0f);
+    EXPECT_EQ(scanner.getNextToken().kind, TokenType::INVALID_LIT);
+
+    // The same holds beyond the double range, whatever the case of the exponent.
+    for (const char* lexeme : {"1.0e-400", "1.0E-400"}) {
+        Token beyond = scanner.getNextToken();
+        EXPECT_EQ(beyond.kind, TokenType::FLOATLIT) << lexeme;
+        EXPECT_EQ(beyond.lexeme, lexeme);
+        EXPECT_EQ(beyond.literal.floatValue, 0.0f) << lexeme;
+    }
+    EXPECT_EQ(scanner.getNextToken().kind, TokenType::INVALID_LIT);
+}
+
+TEST(ParsingTableTest, SymbolsAreNumberedByKind) {
+    const std::string path = ::testing::TempDir() + "parsing_table_test.csv";
+    {
+        std::ofstream csv(path);
+        csv << ",$,id,plus\n"
+            << "START,START -> E,START -> E,\n"
+            << "E,,E -> id _push T,\n"
+            << "T,T -> &epsilon,,T -> plus id _add T\n";
+    }
+    ParsingTable table(path);
+    std::remove(path.c_str());
+
+    // Terminals, then non-terminals, then actions.
+    EXPECT_EQ(table.getSymbol("$"), 0);
+    EXPECT_EQ(table.getSymbol("plus"), 2);
+    EXPECT_EQ(table.getSymbol("START"), 3);
+    EXPECT_EQ(table.getSymbol("T"), 5);
+    EXPECT_TRUE(table.isTerminal(table.getSymbol("id")));
+    EXPECT_TRUE(table.isNonTerminal(table.getSymbol("E")));
+    EXPECT_TRUE(table.isAction(table.getSymbol("_add")));
+    EXPECT_EQ(table.getSymbol("&epsilon"), ParsingTable::NO_SYMBOL);
+    EXPECT_EQ(table.getStartSymbol(), table.getSymbol("START"));
+    EXPECT_EQ(table.getEndSymbol(), table.getSymbol("$"));
+
+    EXPECT_EQ(table.getTerminal(TokenType::ID), table.getSymbol("id"));
+    EXPECT_EQ(table.getTerminal(TokenType::COMMA), ParsingTable::NO_SYMBOL);
+
+    ParsingTable::Symbol t = table.getSymbol("T");
+    EXPECT_EQ(table.getProductionText(table.getProduction(t, table.getTerminal(TokenType::PLUS))),
+              "T -> plus id _add T");
+    EXPECT_EQ(table.getProduction(table.getSymbol("E"), table.getSymbol("plus")), ParsingTable::NO_PRODUCTION);
+    EXPECT_EQ(table.getProduction(t, ParsingTable::NO_SYMBOL), ParsingTable::NO_PRODUCTION);
+    EXPECT_EQ(table.getProduction(table.getStartSymbol(), table.getSymbol("$")),
+              table.getProduction(table.getStartSymbol(), table.getSymbol("id")));
+    EXPECT_EQ(table.getProduction("T", "$"), "T -> &epsilon");
+    EXPECT_EQ(table.getProduction("E", "$"), "error");
+
+    // Right-hand sides are pre-split in push order.
+    ParsingTable::ProductionId more = table.getProduction(t, table.getSymbol("plus"));
+    std::vector<ParsingTable::Symbol> pushed(table.getReversedRHS(more).begin(), table.getReversedRHS(more).end());
+    EXPECT_EQ(pushed, (std::vector<ParsingTable::Symbol>{t, table.getSymbol("_add"), table.getSymbol("id"),
+                                                          table.getSymbol("plus")}));
+    EXPECT_EQ(table.getDerivationText(more), " plus id T");
+    ParsingTable::ProductionId empty = table.getProduction(t, table.getEndSymbol());
+    EXPECT_EQ(table.getReversedRHS(empty).size(), 0u);
+    EXPECT_EQ(table.getDerivationText(empty), "");
+
+    // FIRST, FOLLOW and nullable skip over semantic actions.
+    EXPECT_TRUE(table.isInFirst("START", "id"));
+    EXPECT_TRUE(table.isInFirst("T", "plus"));
+    EXPECT_FALSE(table.isInFirst("T", "id"));
+    EXPECT_TRUE(table.hasEpsilon("T"));
+    EXPECT_FALSE(table.hasEpsilon("E"));
+    EXPECT_TRUE(table.isInFollow("T", "$"));
+    EXPECT_TRUE(table.isInFollow("E", "$"));
+    EXPECT_FALSE(table.isInFollow("E", "plus"));
+    EXPECT_EQ(table.getFirstSet("E"), std::vector<std::string>{"id"});
+}
+
+TEST(ParsingTableTest, GrammarTableIsLL1) {
+    const std::string path = ::testing::TempDir() + "parsing_table_test.grm";
+    {
+        std::ofstream grm(path);
+        grm << "START -> E .\n"
+            << "E -> id _push T .\n"
+            << "T -> plus id _add T | _end.\n";
+    }
+    ParsingTable table(path);
+    EXPECT_TRUE(table.getConflicts().empty());
+    EXPECT_EQ(table.getTerminals(), (std::vector<std::string>{"$", "id", "plus"}));
+    EXPECT_EQ(table.getNonTerminals(), (std::vector<std::string>{"START", "E", "T"}));
+    EXPECT_EQ(table.getProduction("T", "plus"), "T -> plus id _add T");
+    EXPECT_EQ(table.getProduction("T", "$"), "T -> _end &epsilon");
+    EXPECT_EQ(table.getProduction("T", "id"), "error");
+    EXPECT_TRUE(table.hasEpsilon("T"));
+    EXPECT_TRUE(table.isInFollow("T", "$"));
+
+    // Both alternatives of A start with id.
+    {
+        std::ofstream grm(path);
+        grm << "START -> A .\n"
+            << "A -> id plus | id | .\n";
+    }
+    ParsingTable conflicting(path);
+    std::remove(path.c_str());
+    ASSERT_EQ(conflicting.getConflicts().size(), 1u);
+    EXPECT_EQ(conflicting.getConflicts()[0], "M[A, id]: A -> id plus | A -> id");
+    EXPECT_EQ(conflicting.getProduction("A", "id"), "A -> id plus");
+    EXPECT_EQ(conflicting.getProduction("A", "$"), "A -> &epsilon");
+}
+
+TEST(ParsingTableTest, ReversedRHSIsClassified) {
+    const std::string path = ::testing::TempDir() + "reversed_rhs_test.grm";
+    {
+        std::ofstream grm(path);
+        grm << "START -> E .\n"
+            << "E -> id _push T .\n"
+            << "T -> plus id _add T | _end.\n";
+    }
+    ParsingTable table(path);
+    std::remove(path.c_str());
+    auto names = [&table](ParsingTable::ReversedRHS rhs) {
+        std::vector<std::string> result;
+        for (ParsingTable::Symbol symbol : rhs) {
+            result.push_back(table.getSymbolName(symbol));
+        }
+        return result;
+    };
+
+    // Right-hand sides are stored last symbol first, ready to push.
+    ParsingTable::ProductionId add = table.getProduction(table.getSymbol("T"), table.getSymbol("plus"));
+    ASSERT_NE(add, ParsingTable::NO_PRODUCTION);
+    ParsingTable::ReversedRHS rhs = table.getReversedRHS(add);
+    EXPECT_EQ(names(rhs), (std::vector<std::string>{"T", "_add", "id", "plus"}));
+    EXPECT_TRUE(table.isNonTerminal(rhs.begin()[0]));
+    EXPECT_TRUE(table.isAction(rhs.begin()[1]));
+    EXPECT_TRUE(table.isTerminal(rhs.begin()[2]));
+    EXPECT_TRUE(table.isTerminal(rhs.begin()[3]));
+
+    // An epsilon production keeps only its actions.
+    ParsingTable::ProductionId end = table.getProduction(table.getSymbol("T"), table.getEndSymbol());
+    ASSERT_NE(end, ParsingTable::NO_PRODUCTION);
+    EXPECT_EQ(names(table.getReversedRHS(end)), std::vector<std::string>{"_end"});
+    EXPECT_TRUE(table.isAction(*table.getReversedRHS(end).begin()));
+    EXPECT_EQ(table.getDerivationText(end), "");
+
+    ParsingTable::ProductionId push = table.getProduction(table.getSymbol("E"), table.getSymbol("id"));
+    EXPECT_EQ(names(table.getReversedRHS(push)), (std::vector<std::string>{"T", "_push", "id"}));
+    EXPECT_TRUE(table.isAction(table.getSymbol("_push")));
+    EXPECT_FALSE(table.isAction(table.getSymbol("id")));
+}
+
+TEST(ParsingTableTest, GrammarTableMatchesCSV) {
+    ParsingTable grammar(ATTRIBUTE_GRAMMAR);
+    ParsingTable csv(ATTRIBUTE_GRAMMAR_CSV);
+    EXPECT_TRUE(grammar.getConflicts().empty());
+
+    // The symbols may be numbered differently, but every cell selects the same production.
+    auto body = [](const ParsingTable& table, ParsingTable::ProductionId id) {
+        std::vector<std::string> names;
+        for (ParsingTable::Symbol symbol : table.getReversedRHS(id)) {
+            names.push_back(table.getSymbolName(symbol));
+        }
+        return names;
+    };
+    ASSERT_EQ(grammar.getSymbolCount(), csv.getSymbolCount());
+    ASSERT_EQ(grammar.getNonTerminals(), csv.getNonTerminals());
+    for (const auto& nt : csv.getNonTerminals()) {
+        EXPECT_EQ(grammar.hasEpsilon(nt), csv.hasEpsilon(nt));
+        for (const auto& t : csv.getTerminals()) {
+            ParsingTable::ProductionId a = grammar.getProduction(grammar.getSymbol(nt), grammar.getSymbol(t));
+            ParsingTable::ProductionId b = csv.getProduction(csv.getSymbol(nt), csv.getSymbol(t));
+            ASSERT_EQ(a == ParsingTable::NO_PRODUCTION, b == ParsingTable::NO_PRODUCTION) << nt << ", " << t;
+            if (a != ParsingTable::NO_PRODUCTION) {
+                EXPECT_EQ(body(grammar, a), body(csv, b)) << nt << ", " << t;
+                EXPECT_EQ(grammar.getDerivationText(a), csv.getDerivationText(b));
+            }
+            EXPECT_EQ(grammar.isInFirst(nt, t), csv.isInFirst(nt, t));
+            EXPECT_EQ(grammar.isInFollow(nt, t), csv.isInFollow(nt, t));
+        }
+    }
+}
+
+TEST(ParsingTableTest, AttributeGrammarSets) {
+    ParsingTable table(ATTRIBUTE_GRAMMAR);
+    auto sorted = [](std::vector<std::string> names) {
+        std::sort(names.begin(), names.end());
+        return names;
+    };
+
+    // A program is any number of classes, implementations and functions.
+    EXPECT_TRUE(table.hasEpsilon("PROG"));
+    EXPECT_EQ(sorted(table.getFirstSet("PROG")),
+              (std::vector<std::string>{"class", "constructor", "function", "implementation"}));
+    EXPECT_TRUE(table.isInFollow("PROG", "$"));
+    EXPECT_FALSE(table.isInFollow("PROG", "semi"));
+
+    EXPECT_FALSE(table.hasEpsilon("STATEMENT"));
+    EXPECT_EQ(sorted(table.getFirstSet("STATEMENT")),
+              (std::vector<std::string>{"id", "if", "read", "return", "self", "while", "write"}));
+    EXPECT_FALSE(table.hasEpsilon("VISIBILITY"));
+    EXPECT_EQ(sorted(table.getFirstSet("VISIBILITY")), (std::vector<std::string>{"private", "public"}));
+
+    // Nullable through an action-only alternative; FOLLOW comes from the if and while statements.
+    EXPECT_TRUE(table.hasEpsilon("STATBLOCK"));
+    EXPECT_TRUE(table.isInFollow("STATBLOCK", "else"));
+    EXPECT_TRUE(table.isInFollow("STATBLOCK", "semi"));
+    EXPECT_FALSE(table.isInFollow("STATBLOCK", "$"));
+    EXPECT_TRUE(table.hasEpsilon("STATEMENTS"));
+    EXPECT_TRUE(table.isInFollow("STATEMENTS", "rcurbr"));
+    EXPECT_FALSE(table.isInFollow("STATEMENTS", "semi"));
+    EXPECT_TRUE(table.hasEpsilon("ARRAYSIZES"));
+    EXPECT_TRUE(table.isInFollow("ARRAYSIZES", "semi"));
+}
+
+TEST(ParsingTableTest, CompiledTableMatchesGrammar) {
+    ParsingTable loaded(ATTRIBUTE_GRAMMAR);
+    ParsingTable compiled(AttributeGrammarTable::table);
+
+    ASSERT_EQ(compiled.getSymbolCount(), loaded.getSymbolCount());
+    ASSERT_EQ(compiled.getProductionCount(), loaded.getProductionCount());
+    ASSERT_EQ(compiled.getTerminals(), loaded.getTerminals());
+    ASSERT_EQ(compiled.getNonTerminals(), loaded.getNonTerminals());
+    for (size_t s = 0; s < loaded.getSymbolCount(); ++s) {
+        EXPECT_EQ(compiled.getSymbolName(static_cast<ParsingTable::Symbol>(s)),
+                  loaded.getSymbolName(static_cast<ParsingTable::Symbol>(s)));
+    }
+    for (const auto& nt : loaded.getNonTerminals()) {
+        EXPECT_EQ(compiled.hasEpsilon(nt), loaded.hasEpsilon(nt));
+        for (const auto& t : loaded.getTerminals()) {
+            EXPECT_EQ(compiled.getProduction(nt, t), loaded.getProduction(nt, t));
+            EXPECT_EQ(compiled.isInFirst(nt, t), loaded.isInFirst(nt, t));
+            EXPECT_EQ(compiled.isInFollow(nt, t), loaded.isInFollow(nt, t));
+        }
+    }
+    for (size_t p = 0; p < loaded.getProductionCount(); ++p) {
+        auto id = static_cast<ParsingTable::ProductionId>(p);
+        EXPECT_EQ(compiled.getProductionHead(id), loaded.getProductionHead(id));
+        EXPECT_EQ(compiled.getDerivationText(id), loaded.getDerivationText(id));
+        std::vector<ParsingTable::Symbol> a(compiled.getReversedRHS(id).begin(), compiled.getReversedRHS(id).end());
+        std::vector<ParsingTable::Symbol> b(loaded.getReversedRHS(id).begin(), loaded.getReversedRHS(id).end());
+        EXPECT_EQ(a, b);
+    }
+    EXPECT_EQ(compiled.getTerminal(TokenType::ID), loaded.getTerminal(TokenType::ID));
+    EXPECT_EQ(compiled.getStartSymbol(), loaded.getStartSymbol());
+}
+
+TEST(ParsingTableTest, RowDisplacementKeepsEveryCell) {
+    ParsingTable table(AttributeGrammarTable::table);
+    const size_t terminalCount = table.getTerminals().size();
+    const size_t rowCount = table.getNonTerminals().size();
+
+    size_t filled = 0;
+    for (size_t row = 0; row < rowCount; ++row) {
+        for (size_t t = 0; t < terminalCount; ++t) {
+            filled += table.getProduction(static_cast<ParsingTable::Symbol>(terminalCount + row),
+                                          static_cast<ParsingTable::Symbol>(t)) != ParsingTable::NO_PRODUCTION;
+        }
+    }
+
+    // Every owned slot is the cell its row offset and column point at, and nothing else is filled.
+    size_t owned = 0;
+    const auto& slots = table.getPackedCells();
+    for (size_t i = 0; i < slots.size(); ++i) {
+        if (slots[i].row == ParsingTable::NO_SYMBOL) continue;
+        owned++;
+        ASSERT_LT(slots[i].row, rowCount);
+        size_t offset = table.getRowOffsets()[slots[i].row];
+        ASSERT_GE(i, offset);
+        ASSERT_LT(i - offset, terminalCount);
+        EXPECT_EQ(table.getProduction(static_cast<ParsingTable::Symbol>(terminalCount + slots[i].row),
+                                      static_cast<ParsingTable::Symbol>(i - offset)),
+                  slots[i].production);
+    }
+    EXPECT_EQ(owned, filled);
+    for (uint32_t offset : table.getRowOffsets()) {
+        EXPECT_LE(offset + terminalCount, slots.size());
+    }
+    EXPECT_LT(slots.size(), rowCount * terminalCount / 4);
+}
+
+// Collects the interned identifiers of an AST in preorder.
+static void collectSymbols(ASTNode* node, std::vector<SymbolId>& symbols) {
+    for (; node != nullptr; node = node->getRightSibling()) {
+        if (node->getSymbolId() != NO_SYMBOL) symbols.push_back(node->getSymbolId());
+        collectSymbols(node->getLeftMostChild(), symbols);
+    }
+}
+
+// Flattens an AST into a string so trees from different parses can be compared.
+static std::string describeTree(ASTNode* node) {
+    std::string text;
+    for (; node != nullptr; node = node->getRightSibling()) {
+        text += node->getNodeType() + ":" + node->getNodeValue() + "(" + describeTree(node->getLeftMostChild()) + ")";
+    }
+    return text;
+}
+
+TEST(ParserTest, ReentrantParsersShareTable) {
+    const std::string factorial =
+        "function factorial(n: int) => int\n"
+        "{\n"
+        "  local result: int;\n"
+        "  result := 1;\n"
+        "  while(n > 1) { result := result * n; n := n - 1; };\n"
+        "  return(result);\n"
+        "}\n"
+        "function main() => void\n"
+        "{\n"
+        "  write(factorial(5));\n"
+        "}\n";
+    const std::string simpleMain = "function main() => void\n{\n  local x: float;\n  x := 1.5;\n}\n";
+
+    std::shared_ptr<const ParsingTable> table = Parser::loadTable("");
+    EXPECT_EQ(table, Parser::loadTable(""));
+
+    Parser parser("factorial.src", table, Scanner::fromText(factorial));
+    ASSERT_TRUE(parser.parse());
+    const std::string expected = describeTree(parser.getAST().getRoot());
+    ASSERT_NE(expected.find("factorial"), std::string::npos);
+
+    // A reset parser starts over on the new input and matches a fresh one.
+    parser.reset("main.src", Scanner::fromText(simpleMain));
+    ASSERT_TRUE(parser.parse());
+    Parser fresh("main.src", table, Scanner::fromText(simpleMain));
+    ASSERT_TRUE(fresh.parse());
+    EXPECT_EQ(describeTree(parser.getAST().getRoot()), describeTree(fresh.getAST().getRoot()));
+
+    parser.reset("factorial.src", Scanner::fromText(factorial));
+    ASSERT_TRUE(parser.parse());
+    EXPECT_EQ(describeTree(parser.getAST().getRoot()), expected);
+
+    // Parsers on several threads share the table and do not disturb each other.
+    constexpr int THREADS = 4;
+    constexpr int FILES_PER_THREAD = 25;
+    std::vector<int> matches(THREADS, 0);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < THREADS; ++t) {
+        workers.emplace_back([&, t] {
+            Parser worker("factorial.src", table, Scanner::fromText(factorial));
+            for (int i = 0; i < FILES_PER_THREAD; ++i) {
+                if (i > 0) {
+                    worker.reset("factorial.src", Scanner::fromText(factorial));
+                }
+                if (worker.parse() && describeTree(worker.getAST().getRoot()) == expected) {
+                    matches[t]++;
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    for (int t = 0; t < THREADS; ++t) {
+        EXPECT_EQ(matches[t], FILES_PER_THREAD);
+    }
+}
+
+TEST(ParserTest, PipelinedParseMatchesSequential) {
+    std::string source;
+    for (int i = 0; i < 300; ++i) {
+        source += "function f" + std::to_string(i) + "(n: int) => int\n{\n"
+                  "  local r: float;\n  r := n * 2.5 + " + std::to_string(i) + ";\n  return(r);\n}\n";
+    }
+    source += "function main() => void\n{\n  write(f1(2));\n}\n";
+
+    std::shared_ptr<const ParsingTable> table = Parser::loadTable("");
+    StringInterner sequentialInterner, pipelinedInterner;
+    Parser sequential("big.src", table, Scanner::fromText(source));
+    sequential.setInterner(&sequentialInterner);
+    ASSERT_TRUE(sequential.parse());
+    Parser pipelined("big.src", table, Scanner::fromText(source));
+    pipelined.setInterner(&pipelinedInterner);
+    pipelined.setPipelined(true);
+    ASSERT_TRUE(pipelined.parse());
+    EXPECT_EQ(describeTree(pipelined.getAST().getRoot()), describeTree(sequential.getAST().getRoot()));
+
+    // Identifiers reach the AST interned by the producer thread, in the same order.
+    std::vector<SymbolId> sequentialSymbols, pipelinedSymbols;
+    collectSymbols(sequential.getAST().getRoot(), sequentialSymbols);
+    collectSymbols(pipelined.getAST().getRoot(), pipelinedSymbols);
+    ASSERT_FALSE(sequentialSymbols.empty());
+    EXPECT_EQ(pipelinedSymbols, sequentialSymbols);
+    EXPECT_EQ(pipelinedInterner.size(), sequentialInterner.size());
+
+    // Syntax errors are located in the source while the producer thread is still scanning.
+    const std::string bad = "function main( => void {} " + source;
+    pipelined.reset("bad.src", Scanner::fromText(bad));
+    EXPECT_FALSE(pipelined.parse());
+}
+
+TEST(ParserTest, RecoveryStopsReportingAtEndOfInput) {
+    // The input ends inside nested blocks: the end of input is reported once,
+    // and the rest of the parse stack is dropped without further errors.
+    const std::string source =
+        "function main() => void\n{\n  while (x < 1) {\n    if (x > 2) then {\n      x := 1;\n";
+    Parser parser("truncated.src", Parser::loadTable(""), Scanner::fromText(source));
+    EXPECT_FALSE(parser.parse());
+    const std::string base = ::testing::TempDir() + "truncated";
+    ASSERT_TRUE(parser.writeOutputFiles(base));
+
+    std::ifstream errors(base + ".outsyntaxerrors");
+    int endOfInputErrors = 0;
+    std::string line;
+    while (std::getline(errors, line)) {
+        if (line.find("Syntax error") != std::string::npos && line.find("'$'") != std::string::npos) {
+            ++endOfInputErrors;
+        }
+    }
+    EXPECT_EQ(endOfInputErrors, 1);
+    EXPECT_NE(parser.getAST().getRoot(), nullptr);
+    for (const char* extension : {".outsyntaxerrors", ".dot"}) {
+        std::remove((base + extension).c_str());
+    }
+
+    // The tree keeps growing after an error, so the functions that follow it are in the .dot output.
+    parser.reset("recovered.src", Scanner::fromText("function broken() => void\n{\n  x := ;\n}\n"
+                                                     "function main() => void\n{\n  write(1);\n}\n"));
+    EXPECT_FALSE(parser.parse());
+    EXPECT_NE(describeTree(parser.getAST().getRoot()).find("main"), std::string::npos);
+}
+
+TEST(ParserTest, StackHighWaterMark) {
+    std::shared_ptr<const ParsingTable> table = Parser::loadTable("");
+    const std::string flat = "function main() => void\n{\n  write(1);\n}\n";
+    const std::string nested =
+        "function main() => void\n{\n"
+        "  while (1 < 2) { while (1 < 2) { while (1 < 2) { write(1 + 2 * 3); }; }; };\n"
+        "}\n";
+
+    Parser parser("flat.src", table, Scanner::fromText(flat));
+    EXPECT_EQ(parser.getStackHighWater(), 0u);
+    ASSERT_TRUE(parser.parse());
+    const size_t flatDepth = parser.getStackHighWater();
+    EXPECT_GT(flatDepth, 2u);
+
+    Parser deep("nested.src", table, Scanner::fromText(nested));
+    ASSERT_TRUE(deep.parse());
+    const size_t nestedDepth = deep.getStackHighWater();
+    EXPECT_GT(nestedDepth, flatDepth);
+
+    // The mark is the deepest over every parse, and a parse of the same input reaches it again.
+    parser.reset("nested.src", Scanner::fromText(nested));
+    ASSERT_TRUE(parser.parse());
+    EXPECT_EQ(parser.getStackHighWater(), nestedDepth);
+    parser.reset("flat.src", Scanner::fromText(flat));
+    ASSERT_TRUE(parser.parse());
+    EXPECT_EQ(parser.getStackHighWater(), nestedDepth);
+}
+
+TEST(ParserTest, DerivationIsRecordedOnRequest) {
+    const std::string source = "function main() => void\n{\n  write(1);\n}\n";
+    const std::string expected =
+        "(START, START -> _createRoot PROG)\n"
+        "( PROG, PROG -> CLASSIMPLFUNC _addToProgram PROG)\n"
+        "(  CLASSIMPLFUNC PROG, CLASSIMPLFUNC -> FUNCDEF)\n"
+        "(   FUNCDEF PROG, FUNCDEF -> FUNCHEAD _addStatementsList FUNCBODY _createFunction)\n"
+        "(    FUNCHEAD FUNCBODY PROG, FUNCHEAD -> function id _createFunctionId lpar FPARAMS rpar arrow RETURNTYPE _createFunctionSignature)\n"
+        "(     function id lpar FPARAMS rpar arrow RETURNTYPE FUNCBODY PROG, FPARAMS -> _createParamList &epsilon)\n"
+        "(     function id lpar  rpar arrow RETURNTYPE FUNCBODY PROG, RETURNTYPE -> void _setTypeVoid)\n"
+        "(     function id lpar  rpar arrow  void FUNCBODY PROG, FUNCBODY -> lcurbr LOCALVARDECLORSTAT2 rcurbr _createFunctionBody)\n"
+        "(     function id lpar  rpar arrow  void  lcurbr LOCALVARDECLORSTAT2 rcurbr PROG, LOCALVARDECLORSTAT2 -> LOCALVARDECLORSTAT _addBodyStatement LOCALVARDECLORSTAT2)\n"
+        "(     function id lpar  rpar arrow  void  lcurbr  LOCALVARDECLORSTAT LOCALVARDECLORSTAT2 rcurbr PROG, LOCALVARDECLORSTAT -> STATEMENT)\n"
+        "(     function id lpar  rpar arrow  void  lcurbr   STATEMENT LOCALVARDECLORSTAT2 rcurbr PROG, STATEMENT -> write lpar EXPR rpar semi _createWriteStatement)\n"
+        "(     function id lpar  rpar arrow  void  lcurbr    write lpar EXPR rpar semi LOCALVARDECLORSTAT2 rcurbr PROG, EXPR -> ARITHEXPR EXPR2 _finishExpression)\n"
+        "(     function id lpar  rpar arrow  void  lcurbr    write lpar  ARITHEXPR EXPR2 rpar semi LOCALVARDECLORSTAT2 rcurbr PROG, ARITHEXPR -> TERM RIGHTRECARITHEXPR _finishArithExpr)\n"
+        "(     function id lpar  rpar arrow  void  lcurbr    write lpar   TERM RIGHTRECARITHEXPR EXPR2 rpar semi LOCALVARDECLORSTAT2 rcurbr PROG, TERM -> FACTOR _addTerm RIGHTRECTERM)\n"
+        "(     function id lpar  rpar arrow  void  lcurbr    write lpar    FACTOR RIGHTRECTERM RIGHTRECARITHEXPR EXPR2 rpar semi LOCALVARDECLORSTAT2 rcurbr PROG, FACTOR -> intlit _pushIntLiteral)\n"
+        "(     function id lpar  rpar arrow  void  lcurbr    write lpar     intlit RIGHTRECTERM RIGHTRECARITHEXPR EXPR2 rpar semi LOCALVARDECLORSTAT2 rcurbr PROG, RIGHTRECTERM -> &epsilon)\n"
+        "(     function id lpar  rpar arrow  void  lcurbr    write lpar     intlit  RIGHTRECARITHEXPR EXPR2 rpar semi LOCALVARDECLORSTAT2 rcurbr PROG, RIGHTRECARITHEXPR -> &epsilon)\n"
+        "(     function id lpar  rpar arrow  void  lcurbr    write lpar     intlit   EXPR2 rpar semi LOCALVARDECLORSTAT2 rcurbr PROG, EXPR2 -> &epsilon)\n"
+        "(     function id lpar  rpar arrow  void  lcurbr    write lpar     intlit    rpar semi LOCALVARDECLORSTAT2 rcurbr PROG, LOCALVARDECLORSTAT2 -> &epsilon)\n"
+        "(     function id lpar  rpar arrow  void  lcurbr    write lpar     intlit    rpar semi  rcurbr PROG, PROG -> &epsilon)\n"
+        "(     function id lpar  rpar arrow  void  lcurbr    write lpar     intlit    rpar semi  rcurbr , $)\n";
+    const std::string base = ::testing::TempDir() + "derivation";
+    auto slurp = [](const std::string& path) {
+        std::ifstream in(path);
+        std::stringstream contents;
+        contents << in.rdbuf();
+        return contents.str();
+    };
+
+    // Off by default: no .outderivation file is written.
+    std::remove((base + ".outderivation").c_str());
+    Parser parser("main.src", Parser::loadTable(""), Scanner::fromText(source));
+    ASSERT_TRUE(parser.parse());
+    ASSERT_TRUE(parser.writeOutputFiles(base));
+    EXPECT_FALSE(std::filesystem::exists(base + ".outderivation"));
+
+    // Recorded, the derivation is rebuilt from the applied productions when the files are written.
+    parser.reset("main.src", Scanner::fromText(source));
+    parser.setRecordDerivation(true);
+    ASSERT_TRUE(parser.parse());
+    ASSERT_TRUE(parser.writeOutputFiles(base));
+    EXPECT_EQ(slurp(base + ".outderivation"), expected);
+
+    for (const char* extension : {".outderivation", ".outsyntaxerrors", ".dot"}) {
+        std::remove((base + extension).c_str());
+    }
+}
+
+TEST(ParserTest, SemanticActionsResolveByName) {
+    EXPECT_EQ(AST::resolveAction("_createRoot"), SemanticAction::CREATE_ROOT);
+    EXPECT_EQ(AST::resolveAction("_setTypeVoid"), SemanticAction::SET_TYPE_VOID);
+    EXPECT_EQ(AST::resolveAction("_processArrayAccess"), SemanticAction::PROCESS_ARRAY_ACCESS);
+    // Actions the AST does not implement are resolved to a no-op.
+    EXPECT_EQ(AST::resolveAction("_pushSign"), SemanticAction::NONE);
+    EXPECT_EQ(AST::resolveAction("createRoot"), SemanticAction::NONE);
+}
+
+TEST(ParserTest, RecursiveDescentMatchesTable) {
+    std::shared_ptr<const ParsingTable> table = Parser::loadTable("");
+    std::vector<std::string> files;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(EXAMPLES_DIR)) {
+        // bubblesort.src crashes the AST builder on its empty else block, whichever backend parses it.
+        if (entry.path().extension() == ".src" && entry.path().stem().string().find("bubblesort") == std::string::npos) {
+            files.push_back(entry.path().string());
+        }
+    }
+    ASSERT_FALSE(files.empty());
+
+    for (const std::string& file : files) {
+        SCOPED_TRACE(file);
+        Parser tableDriven(file, table, Scanner(file));
+        tableDriven.setRecordDerivation(true);
+        const bool accepted = tableDriven.parse();
+        Parser recursiveDescent(file, table, Scanner(file));
+        recursiveDescent.setRecordDerivation(true);
+        recursiveDescent.setRecursiveDescent(true);
+        // Both backends accept the same files and build the same tree (the .dot file without node numbers).
+        ASSERT_EQ(recursiveDescent.parse(), accepted);
+        if (accepted) {
+            EXPECT_EQ(describeTree(recursiveDescent.getAST().getRoot()), describeTree(tableDriven.getAST().getRoot()));
+        }
+    }
+
+    // The generated parser only exists for the built-in table.
+    Parser custom("main.src", std::make_shared<const ParsingTable>(ATTRIBUTE_GRAMMAR_CSV),
+                  Scanner::fromText("function main() => void {}"));
+    EXPECT_THROW(custom.setRecursiveDescent(true), std::runtime_error);
+}
+
+TEST(ParserTest, ASTNodesLiveInArena) {
+    ASTArena arena;
+    std::vector<ASTNode*> nodes;
+    for (size_t i = 0; i < ASTArena::NODES_PER_BLOCK + 3; ++i) {
+        nodes.push_back(arena.create(NodeType::IDENTIFIER, "n" + std::to_string(i)));
+    }
+    EXPECT_EQ(arena.getNodeCount(), nodes.size());
+    EXPECT_EQ(arena.getAllocatedBytes(), nodes.size() * sizeof(ASTNode));
+    EXPECT_EQ(arena.getReservedBytes(), 2 * ASTArena::NODES_PER_BLOCK * sizeof(ASTNode));
+    // Nodes of a block are laid out in creation order.
+    for (size_t i = 1; i < ASTArena::NODES_PER_BLOCK; ++i) {
+        EXPECT_EQ(nodes[i], nodes[i - 1] + 1);
+    }
+    EXPECT_EQ(nodes.back()->getNodeValue(), "n" + std::to_string(nodes.size() - 1));
+    arena.release();
+    EXPECT_EQ(arena.getNodeCount(), 0u);
+    EXPECT_EQ(arena.getReservedBytes(), 0u);
+
+    // A parser given an arena builds its tree there; the tree outlives the parser.
+    const std::string source = "function main() => void\n{\n  local x: int;\n  x := 1 + 2;\n  write(x);\n}\n";
+    std::string expected;
+    {
+        Parser parser("main.src", Parser::loadTable(""), Scanner::fromText(source));
+        parser.setArena(&arena);
+        ASSERT_TRUE(parser.parse());
+        EXPECT_EQ(&parser.getAST().getArena(), &arena);
+        expected = describeTree(parser.getAST().getRoot());
+        AST ast = std::move(parser.getAST());
+        parser.reset("main.src", Scanner::fromText(source));
+        ASSERT_TRUE(parser.parse());
+        EXPECT_EQ(describeTree(ast.getRoot()), expected);
+    }
+    ASSERT_GT(arena.getNodeCount(), 0u);
+    const size_t perParse = arena.getNodeCount() / 2;
+    EXPECT_EQ(arena.getNodeCount(), 2 * perParse);
+
+    // Without one, the parser's own arena is emptied by reset().
+    Parser parser("main.src", Parser::loadTable(""), Scanner::fromText(source));
+    ASSERT_TRUE(parser.parse());
+    EXPECT_EQ(parser.getAST().getArena().getNodeCount(), perParse);
+    parser.reset("main.src", Scanner::fromText(source));
+    EXPECT_EQ(parser.getAST().getArena().getNodeCount(), 0u);
+    ASSERT_TRUE(parser.parse());
+    EXPECT_EQ(describeTree(parser.getAST().getRoot()), expected);
+
+    // A tree moved out of the parser takes the parser's arena with it; the
+    // parser builds its next tree in a new one, even after the old tree is gone.
+    {
+        AST moved = std::move(parser.getAST());
+        EXPECT_EQ(parser.getAST().getRoot(), nullptr);
+        EXPECT_EQ(describeTree(moved.getRoot()), expected);
+        EXPECT_EQ(moved.getArena().getNodeCount(), perParse);
+    }
+    parser.reset("main.src", Scanner::fromText(source));
+    ASSERT_TRUE(parser.parse());
+    EXPECT_EQ(describeTree(parser.getAST().getRoot()), expected);
+    EXPECT_EQ(parser.getAST().getArena().getNodeCount(), perParse);
+
+    AST assigned;
+    assigned = std::move(parser.getAST());
+    parser.reset("main.src", Scanner::fromText(source));
+    ASSERT_TRUE(parser.parse());
+    EXPECT_EQ(describeTree(assigned.getRoot()), expected);
+    EXPECT_EQ(describeTree(parser.getAST().getRoot()), expected);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();